@@ -4,17 +4,93 @@
 //           https://www.boost.org/LICENSE_1_0.txt)
 
 #include <boost/math/differentiation/autodiff.hpp>
+#include <boost/math/differentiation/autodiff_split_precision.hpp>
+#include <boost/math/differentiation/autodiff_total_degree.hpp>
 #include <boost/multiprecision/cpp_bin_float.hpp>
+#include <chrono>
+#include <cstddef>
 #include <iostream>
+#include <memory>
 
 using namespace boost::math::differentiation;
 
+std::size_t allocations = 0;
+
+// std::allocator that counts its calls to allocate().
+template <typename T>
+struct counting_allocator {
+  using value_type = T;
+  counting_allocator() = default;
+  template <typename U>
+  counting_allocator(counting_allocator<U> const&) {}
+  T* allocate(std::size_t n) {
+    ++allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+};
+
+template <typename T, typename U>
+bool operator==(counting_allocator<T> const&, counting_allocator<U> const&) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(counting_allocator<T> const&, counting_allocator<U> const&) {
+  return false;
+}
+
 template <typename W, typename X, typename Y, typename Z>
 promote<W, X, Y, Z> f(const W& w, const X& x, const Y& y, const Z& z) {
   using namespace std;
   return exp(w * sin(x * log(y) / z) + sqrt(w * z / (x * y))) + w * w / tan(z);
 }
 
+// Same as f(), but every intermediate result is an lvalue, so no operator or function can reuse the
+// storage of its argument.
+template <typename W, typename X, typename Y, typename Z>
+promote<W, X, Y, Z> f_lvalues(const W& w, const X& x, const Y& y, const Z& z) {
+  using namespace std;
+  auto const logy = log(y);
+  auto const xlogy = x * logy;
+  auto const xlogy_z = xlogy / z;
+  auto const sin_xlogy_z = sin(xlogy_z);
+  auto const w_sin = w * sin_xlogy_z;
+  auto const wz = w * z;
+  auto const xy = x * y;
+  auto const wz_xy = wz / xy;
+  auto const sqrt_wz_xy = sqrt(wz_xy);
+  auto const sum = w_sin + sqrt_wz_xy;
+  auto const exp_sum = exp(sum);
+  auto const ww = w * w;
+  auto const tanz = tan(z);
+  auto const ww_tanz = ww / tanz;
+  return exp_sum + ww_tanz;
+}
+
+// Counts the allocations of func(). With a heap-backed root_type each fvar copy allocates every coefficient,
+// but most allocations are made by the arithmetic on the coefficients themselves. Comparing f() with
+// f_lvalues() shows the copies of intermediate results that the fvar&& operator overloads save.
+template <typename Func>
+std::size_t count_allocations(char const* name, Func const& func) {
+  allocations = 0;
+  auto const v = func();
+  std::cout << name << ": " << allocations << " allocations, "
+            << "derivative = " << v.derivative(3, 2, 4, 3) << '\n';
+  return allocations;
+}
+
+// Times func(), and returns the time per call in microseconds.
+template <typename Func>
+double microseconds(Func const& func) {
+  constexpr int n = 100;
+  auto const start = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; ++i)
+    func();
+  auto const stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(stop - start).count() / n;
+}
+
 int main() {
   using float50 = boost::multiprecision::cpp_bin_float_50;
 
@@ -36,11 +112,69 @@ int main() {
             << "autodiff      : " << v.derivative(Nw, Nx, Ny, Nz) << '\n'
             << std::setprecision(3)
             << "relative error: " << (v.derivative(Nw, Nx, Ny, Nz) / answer - 1) << '\n';
+
+  // Same calculation with a root_type that allocates its limbs from counting_allocator.
+  using float50a =
+      boost::multiprecision::number<boost::multiprecision::cpp_bin_float<
+                                        50,
+                                        boost::multiprecision::digit_base_10,
+                                        counting_allocator<boost::multiprecision::limb_type>>,
+                                    boost::multiprecision::et_off>;
+  auto const variables_a = make_ftuple<float50a, Nw, Nx, Ny, Nz>(11, 12, 13, 14);
+  auto const& wa = std::get<0>(variables_a);
+  auto const& xa = std::get<1>(variables_a);
+  auto const& ya = std::get<2>(variables_a);
+  auto const& za = std::get<3>(variables_a);
+  std::cout << std::setprecision(20);
+  // Temporaries are rvalues, which the fvar&& overloads of the operators modify in place.
+  std::size_t const rvalues = count_allocations("rvalues", [&] { return f(wa, xa, ya, za); });
+  std::size_t const lvalues = count_allocations("lvalues", [&] { return f_lvalues(wa, xa, ya, za); });
+  std::cout << "saved by rvalues: " << lvalues - rvalues << " allocations\n";
+
+  // The gradient and Hessian of f, i.e. all derivatives of total order <= 2. autodiff_fvar<float50,2,2,2,2>
+  // holds them among its 81 coefficients. make_tdtuple<float50,2> holds exactly these 15, and
+  // make_sptuple<float50,double,2,2> holds the value and gradient in float50 and the Hessian in double.
+  auto const fvar_hessian = [] {
+    auto const v = make_ftuple<float50, 2, 2, 2, 2>(11, 12, 13, 14);
+    return f(std::get<0>(v), std::get<1>(v), std::get<2>(v), std::get<3>(v));
+  };
+  auto const tdvar_hessian = [] {
+    auto const v = make_tdtuple<float50, 2>(11, 12, 13, 14);
+    return f(v[0], v[1], v[2], v[3]);
+  };
+  auto const spvar_hessian = [] {
+    auto const v = make_sptuple<float50, double, 2, 2>(11, 12, 13, 14);
+    return f(v[0], v[1], v[2], v[3]);
+  };
+  auto const h = fvar_hessian();
+  auto const t = tdvar_hessian();
+  auto const s = spvar_hessian();
+  std::cout << std::setprecision(std::numeric_limits<float50>::digits10)
+            << "fvar  df/dw    : " << h.derivative(1, 0, 0, 0) << '\n'
+            << "tdvar df/dw    : " << t.derivative(1, 0, 0, 0) << '\n'
+            << "spvar df/dw    : " << s.derivative(1, 0, 0, 0) << '\n'
+            << "fvar  d2f/dwdz : " << h.derivative(1, 0, 0, 1) << '\n'
+            << "tdvar d2f/dwdz : " << t.derivative(1, 0, 0, 1) << '\n'
+            << "spvar d2f/dwdz : " << s.derivative(1, 0, 0, 1) << '\n';
+  double const fvar_us = microseconds(fvar_hessian);
+  double const tdvar_us = microseconds(tdvar_hessian);
+  double const spvar_us = microseconds(spvar_hessian);
+  std::cout << std::setprecision(3) << "us per Hessian: fvar " << fvar_us << ", tdvar " << tdvar_us
+            << ", spvar " << spvar_us << '\n';
   return 0;
 }
 /*
-Output:
+Output, followed by the time per Hessian of each, which depends on the machine:
 mathematica   : 1976.3196007477977177798818752904187209081211892188
 autodiff      : 1976.3196007477977177798818752904187209081211892188
 relative error: 2.67e-50
+rvalues: 268614 allocations, derivative = 1976.3196007477977178
+lvalues: 269571 allocations, derivative = 1976.3196007477977178
+saved by rvalues: 957 allocations
+fvar  df/dw    : 16975.340053651795550090505330005161079370417848759
+tdvar df/dw    : 16975.340053651795550090505330005161079370417848759
+spvar df/dw    : 16975.340053651795550090505330005161079370417848759
+fvar  d2f/dwdz : 19662.603563033417098462387900200245935509845640809
+tdvar d2f/dwdz : 19662.603563033417098462387900200245935509845640809
+spvar d2f/dwdz : 19662.6035630334154120646417140960693359375
 **/
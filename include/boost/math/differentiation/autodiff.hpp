@@ -23,6 +23,56 @@
 #include <ostream>
 #include <tuple>
 #include <type_traits>
+#include <utility>
+
+#include "detail/autodiff_simd.hpp"
+#include "detail/autodiff_series.hpp"
+
+// Arithmetic, comparison and coefficient access of fvar are constexpr as of C++17.
+#ifdef BOOST_NO_CXX17_IF_CONSTEXPR
+#define BOOST_AUTODIFF_CONSTEXPR
+#else
+#define BOOST_AUTODIFF_CONSTEXPR constexpr
+#endif
+
+// The SIMD and series kernels cannot be evaluated in a constant expression, so they are skipped when this is
+// true. Without compiler support it is false, and constant expressions are then limited to the root_types for
+// which those kernels are never selected (e.g. long double).
+#ifndef BOOST_NO_CXX17_IF_CONSTEXPR
+#if defined(__cpp_lib_is_constant_evaluated)
+#define BOOST_AUTODIFF_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define BOOST_AUTODIFF_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#if !defined(BOOST_AUTODIFF_IS_CONSTANT_EVALUATED) && \
+    ((defined(__GNUC__) && !defined(__clang__) && 9 <= __GNUC__) || (defined(_MSC_VER) && 1925 <= _MSC_VER))
+#define BOOST_AUTODIFF_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#ifdef BOOST_AUTODIFF_IS_CONSTANT_EVALUATED
+#define BOOST_AUTODIFF_HAS_IS_CONSTANT_EVALUATED
+#else
+#define BOOST_AUTODIFF_IS_CONSTANT_EVALUATED() false
+#endif
+
+// Greatest Order, up to 2, of an fvar whose RealType is not an fvar, for which the elementary functions
+// compute f(x0), f'(x0) and f''(x0)/2 in closed form instead of by the recurrences of
+// detail/autodiff_series.hpp. 0 selects the recurrences for all Orders.
+#ifndef BOOST_AUTODIFF_CLOSED_FORM_ORDER
+#define BOOST_AUTODIFF_CLOSED_FORM_ORDER 2
+#endif
+
+// Define BOOST_AUTODIFF_SKIP_ZEROS to have the products, quotients and functions of an fvar skip the work on
+// the coefficients of their operands that are 0: a constant operand, a series that ends below its Order, and
+// in a nested fvar, a coefficient fvar that is 0. Off by default, since each call then scans its operands,
+// and the terms with a factor 0 are skipped even if the other factor is inf or NaN. See nonzero_extent().
+
+// Define BOOST_AUTODIFF_FAST_MATH where all coefficients and derivatives are known to be finite. The products
+// of a coefficient 0 by a root_type, and the terms of the recurrences of detail/autodiff_series.hpp, are then
+// computed without first testing for 0, which otherwise keeps a product 0*inf from becoming NaN, and sqrt and
+// pow always compose by Horner's method, rather than summing the powers of epsilon when x0 is near 0.
 
 namespace boost {
 namespace math {
@@ -90,6 +140,30 @@ struct get_order_sum_t<fvar<RealType, Order>>
 template <typename T>
 using get_order_sum = get_order_sum_t<decay_t<T>>;
 
+// True for an fvar whose RealType is not an fvar, of Order 1 (a dual number) up to
+// BOOST_AUTODIFF_CLOSED_FORM_ORDER. See chain_rule().
+template <typename>
+struct is_closed_form_impl : std::false_type {};
+
+template <typename RealType, size_t Order>
+struct is_closed_form_impl<fvar<RealType, Order>>
+    : std::integral_constant<bool,
+                             !is_fvar_impl<RealType>::value && 1 <= Order &&
+                                 Order <= BOOST_AUTODIFF_CLOSED_FORM_ORDER> {};
+
+template <typename T>
+using is_closed_form = is_closed_form_impl<decay_t<T>>;
+
+// True with BOOST_AUTODIFF_SKIP_ZEROS.
+struct skip_zeros : std::integral_constant<bool,
+#ifdef BOOST_AUTODIFF_SKIP_ZEROS
+                                           true
+#else
+                                           false
+#endif
+                                           > {
+};
+
 template <typename RealType>
 struct get_root_type {
   using type = RealType;
@@ -100,6 +174,13 @@ struct get_root_type<fvar<RealType, Order>> {
   using type = typename get_root_type<RealType>::type;
 };
 
+// Type of each lane of a root_type that holds several independent points (see autodiff_batch.hpp),
+// otherwise the root_type itself.
+template <typename RootType>
+struct get_lane_type {
+  using type = RootType;
+};
+
 template <typename RealType, size_t Depth>
 struct type_at {
   using type = RealType;
@@ -127,203 +208,239 @@ class fvar {
   fvar() = default;
 
   // Initialize a variable or constant.
-  fvar(root_type const&, bool const is_variable);
+  BOOST_AUTODIFF_CONSTEXPR fvar(root_type const&, bool const is_variable);
 
   // RealType(cr) | RealType | RealType is copy constructible.
   fvar(fvar const&) = default;
 
+  // Moves each coefficient, which reuses the storage of heap-backed root_types.
+  fvar(fvar&&) = default;
+
   // Be aware of implicit casting from one fvar<> type to another by this copy constructor.
   template <typename RealType2, size_t Order2>
-  fvar(fvar<RealType2, Order2> const&);
+  BOOST_AUTODIFF_CONSTEXPR fvar(fvar<RealType2, Order2> const&);
 
   // RealType(ca) | RealType | RealType is copy constructible from the arithmetic types.
-  explicit fvar(root_type const&);  // Initialize a constant. (No epsilon terms.)
+  BOOST_AUTODIFF_CONSTEXPR explicit fvar(root_type const&);  // Initialize a constant. (No epsilon terms.)
 
+  // Supports any RealType2 for which static_cast<root_type>(ca) compiles.
   template <typename RealType2>
-  fvar(RealType2 const& ca);  // Supports any RealType2 for which static_cast<root_type>(ca) compiles.
+  BOOST_AUTODIFF_CONSTEXPR fvar(RealType2 const& ca);
 
   explicit fvar(char const* ca);  // Converts a char const* string to RealType by boost::lexical_cast
 
   // r = cr | RealType& | Assignment operator.
   fvar& operator=(fvar const&) = default;
 
+  fvar& operator=(fvar&&) = default;
+
   // r = ca | RealType& | Assignment operator from the arithmetic types.
   // Handled by constructor that takes a single parameter of generic type.
   // fvar& operator=(root_type const&); // Set a constant.
 
   // r += cr | RealType& | Adds cr to r.
   template <typename RealType2, size_t Order2>
-  fvar& operator+=(fvar<RealType2, Order2> const&);
+  BOOST_AUTODIFF_CONSTEXPR fvar& operator+=(fvar<RealType2, Order2> const&);
 
   // r += ca | RealType& | Adds ar to r.
-  fvar& operator+=(root_type const&);
+  BOOST_AUTODIFF_CONSTEXPR fvar& operator+=(root_type const&);
 
   // r -= cr | RealType& | Subtracts cr from r.
   template <typename RealType2, size_t Order2>
-  fvar& operator-=(fvar<RealType2, Order2> const&);
+  BOOST_AUTODIFF_CONSTEXPR fvar& operator-=(fvar<RealType2, Order2> const&);
 
   // r -= ca | RealType& | Subtracts ca from r.
-  fvar& operator-=(root_type const&);
+  BOOST_AUTODIFF_CONSTEXPR fvar& operator-=(root_type const&);
 
   // r *= cr | RealType& | Multiplies r by cr.
   template <typename RealType2, size_t Order2>
-  fvar& operator*=(fvar<RealType2, Order2> const&);
+  BOOST_AUTODIFF_CONSTEXPR fvar& operator*=(fvar<RealType2, Order2> const&);
 
   // r *= ca | RealType& | Multiplies r by ca.
-  fvar& operator*=(root_type const&);
+  BOOST_AUTODIFF_CONSTEXPR fvar& operator*=(root_type const&);
 
   // r /= cr | RealType& | Divides r by cr.
   template <typename RealType2, size_t Order2>
-  fvar& operator/=(fvar<RealType2, Order2> const&);
+  BOOST_AUTODIFF_CONSTEXPR fvar& operator/=(fvar<RealType2, Order2> const&);
 
   // r /= ca | RealType& | Divides r by ca.
-  fvar& operator/=(root_type const&);
+  BOOST_AUTODIFF_CONSTEXPR fvar& operator/=(root_type const&);
+
+  // r.add_product(cr1, cr2) | RealType& | Adds cr1 * cr2 to r, convolving into the coefficients of r.
+  BOOST_AUTODIFF_CONSTEXPR fvar& add_product(fvar const&, fvar const&);
+
+  // r.add_product(ca, cr) | RealType& | Adds ca * cr to r.
+  BOOST_AUTODIFF_CONSTEXPR fvar& add_product(root_type const&, fvar const&);
 
   // -r | RealType | Unary Negation.
-  fvar operator-() const;
+  BOOST_AUTODIFF_CONSTEXPR fvar operator-() const&;
+
+  // Negates in place. The binary operators with an fvar&& operand are non-members, defined below.
+  BOOST_AUTODIFF_CONSTEXPR fvar operator-() &&;
 
   // +r | RealType& | Identity Operation.
-  fvar const& operator+() const;
+  BOOST_AUTODIFF_CONSTEXPR fvar const& operator+() const;
 
   // cr + cr2 | RealType | Binary Addition
   template <typename RealType2, size_t Order2>
-  promote<fvar, fvar<RealType2, Order2>> operator+(fvar<RealType2, Order2> const&) const;
+  BOOST_AUTODIFF_CONSTEXPR promote<fvar, fvar<RealType2, Order2>> operator+(
+      fvar<RealType2, Order2> const&) const&;
 
   // cr + ca | RealType | Binary Addition
-  fvar operator+(root_type const&) const;
+  BOOST_AUTODIFF_CONSTEXPR fvar operator+(root_type const&) const&;
 
   // ca + cr | RealType | Binary Addition
   template <typename RealType2, size_t Order2>
-  friend fvar<RealType2, Order2> operator+(typename fvar<RealType2, Order2>::root_type const&,
-                                           fvar<RealType2, Order2> const&);
+  friend BOOST_AUTODIFF_CONSTEXPR fvar<RealType2, Order2> operator+(
+      typename fvar<RealType2, Order2>::root_type const&,
+      fvar<RealType2, Order2> const&);
 
   // cr - cr2 | RealType | Binary Subtraction
   template <typename RealType2, size_t Order2>
-  promote<fvar, fvar<RealType2, Order2>> operator-(fvar<RealType2, Order2> const&) const;
+  BOOST_AUTODIFF_CONSTEXPR promote<fvar, fvar<RealType2, Order2>> operator-(
+      fvar<RealType2, Order2> const&) const&;
 
   // cr - ca | RealType | Binary Subtraction
-  fvar operator-(root_type const&) const;
+  BOOST_AUTODIFF_CONSTEXPR fvar operator-(root_type const&) const&;
 
   // ca - cr | RealType | Binary Subtraction
   template <typename RealType2, size_t Order2>
-  friend fvar<RealType2, Order2> operator-(typename fvar<RealType2, Order2>::root_type const&,
-                                           fvar<RealType2, Order2> const&);
+  friend BOOST_AUTODIFF_CONSTEXPR fvar<RealType2, Order2> operator-(
+      typename fvar<RealType2, Order2>::root_type const&,
+      fvar<RealType2, Order2> const&);
 
   // cr * cr2 | RealType | Binary Multiplication
   template <typename RealType2, size_t Order2>
-  promote<fvar, fvar<RealType2, Order2>> operator*(fvar<RealType2, Order2> const&)const;
+  BOOST_AUTODIFF_CONSTEXPR promote<fvar, fvar<RealType2, Order2>> operator*(
+      fvar<RealType2, Order2> const&) const&;
 
   // cr * ca | RealType | Binary Multiplication
-  fvar operator*(root_type const&)const;
+  BOOST_AUTODIFF_CONSTEXPR fvar operator*(root_type const&) const&;
 
   // ca * cr | RealType | Binary Multiplication
   template <typename RealType2, size_t Order2>
-  friend fvar<RealType2, Order2> operator*(typename fvar<RealType2, Order2>::root_type const&,
-                                           fvar<RealType2, Order2> const&);
+  friend BOOST_AUTODIFF_CONSTEXPR fvar<RealType2, Order2> operator*(
+      typename fvar<RealType2, Order2>::root_type const&,
+      fvar<RealType2, Order2> const&);
 
   // cr / cr2 | RealType | Binary Subtraction
   template <typename RealType2, size_t Order2>
-  promote<fvar, fvar<RealType2, Order2>> operator/(fvar<RealType2, Order2> const&) const;
+  BOOST_AUTODIFF_CONSTEXPR promote<fvar, fvar<RealType2, Order2>> operator/(
+      fvar<RealType2, Order2> const&) const&;
 
   // cr / ca | RealType | Binary Subtraction
-  fvar operator/(root_type const&) const;
+  BOOST_AUTODIFF_CONSTEXPR fvar operator/(root_type const&) const&;
 
   // ca / cr | RealType | Binary Subtraction
   template <typename RealType2, size_t Order2>
-  friend fvar<RealType2, Order2> operator/(typename fvar<RealType2, Order2>::root_type const&,
-                                           fvar<RealType2, Order2> const&);
+  friend BOOST_AUTODIFF_CONSTEXPR fvar<RealType2, Order2> operator/(
+      typename fvar<RealType2, Order2>::root_type const&,
+      fvar<RealType2, Order2> const&);
 
   // For all comparison overloads, only the root term is compared.
 
   // cr == cr2 | bool | Equality Comparison
   template <typename RealType2, size_t Order2>
-  bool operator==(fvar<RealType2, Order2> const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator==(fvar<RealType2, Order2> const&) const;
 
   // cr == ca | bool | Equality Comparison
-  bool operator==(root_type const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator==(root_type const&) const;
 
   // ca == cr | bool | Equality Comparison
   template <typename RealType2, size_t Order2>
-  friend bool operator==(typename fvar<RealType2, Order2>::root_type const&, fvar<RealType2, Order2> const&);
+  friend BOOST_AUTODIFF_CONSTEXPR bool operator==(typename fvar<RealType2, Order2>::root_type const&,
+                                                  fvar<RealType2, Order2> const&);
 
   // cr != cr2 | bool | Inequality Comparison
   template <typename RealType2, size_t Order2>
-  bool operator!=(fvar<RealType2, Order2> const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator!=(fvar<RealType2, Order2> const&) const;
 
   // cr != ca | bool | Inequality Comparison
-  bool operator!=(root_type const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator!=(root_type const&) const;
 
   // ca != cr | bool | Inequality Comparison
   template <typename RealType2, size_t Order2>
-  friend bool operator!=(typename fvar<RealType2, Order2>::root_type const&, fvar<RealType2, Order2> const&);
+  friend BOOST_AUTODIFF_CONSTEXPR bool operator!=(typename fvar<RealType2, Order2>::root_type const&,
+                                                  fvar<RealType2, Order2> const&);
 
   // cr <= cr2 | bool | Less than equal to.
   template <typename RealType2, size_t Order2>
-  bool operator<=(fvar<RealType2, Order2> const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator<=(fvar<RealType2, Order2> const&) const;
 
   // cr <= ca | bool | Less than equal to.
-  bool operator<=(root_type const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator<=(root_type const&) const;
 
   // ca <= cr | bool | Less than equal to.
   template <typename RealType2, size_t Order2>
-  friend bool operator<=(typename fvar<RealType2, Order2>::root_type const&, fvar<RealType2, Order2> const&);
+  friend BOOST_AUTODIFF_CONSTEXPR bool operator<=(typename fvar<RealType2, Order2>::root_type const&,
+                                                  fvar<RealType2, Order2> const&);
 
   // cr >= cr2 | bool | Greater than equal to.
   template <typename RealType2, size_t Order2>
-  bool operator>=(fvar<RealType2, Order2> const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator>=(fvar<RealType2, Order2> const&) const;
 
   // cr >= ca | bool | Greater than equal to.
-  bool operator>=(root_type const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator>=(root_type const&) const;
 
   // ca >= cr | bool | Greater than equal to.
   template <typename RealType2, size_t Order2>
-  friend bool operator>=(typename fvar<RealType2, Order2>::root_type const&, fvar<RealType2, Order2> const&);
+  friend BOOST_AUTODIFF_CONSTEXPR bool operator>=(typename fvar<RealType2, Order2>::root_type const&,
+                                                  fvar<RealType2, Order2> const&);
 
   // cr < cr2 | bool | Less than comparison.
   template <typename RealType2, size_t Order2>
-  bool operator<(fvar<RealType2, Order2> const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator<(fvar<RealType2, Order2> const&) const;
 
   // cr < ca | bool | Less than comparison.
-  bool operator<(root_type const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator<(root_type const&) const;
 
   // ca < cr | bool | Less than comparison.
   template <typename RealType2, size_t Order2>
-  friend bool operator<(typename fvar<RealType2, Order2>::root_type const&, fvar<RealType2, Order2> const&);
+  friend BOOST_AUTODIFF_CONSTEXPR bool operator<(typename fvar<RealType2, Order2>::root_type const&,
+                                                 fvar<RealType2, Order2> const&);
 
   // cr > cr2 | bool | Greater than comparison.
   template <typename RealType2, size_t Order2>
-  bool operator>(fvar<RealType2, Order2> const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator>(fvar<RealType2, Order2> const&) const;
 
   // cr > ca | bool | Greater than comparison.
-  bool operator>(root_type const&) const;
+  BOOST_AUTODIFF_CONSTEXPR bool operator>(root_type const&) const;
 
   // ca > cr | bool | Greater than comparison.
   template <typename RealType2, size_t Order2>
-  friend bool operator>(typename fvar<RealType2, Order2>::root_type const&, fvar<RealType2, Order2> const&);
+  friend BOOST_AUTODIFF_CONSTEXPR bool operator>(typename fvar<RealType2, Order2>::root_type const&,
+                                                 fvar<RealType2, Order2> const&);
 
   // Will throw std::out_of_range if Order < order.
   template <typename... Orders>
-  get_type_at<RealType, sizeof...(Orders)> at(size_t order, Orders... orders) const;
+  BOOST_AUTODIFF_CONSTEXPR get_type_at<RealType, sizeof...(Orders)> at(size_t order, Orders... orders) const;
 
   template <typename... Orders>
-  get_type_at<fvar, sizeof...(Orders)> derivative(Orders... orders) const;
+  BOOST_AUTODIFF_CONSTEXPR get_type_at<fvar, sizeof...(Orders)> derivative(Orders... orders) const;
+
+  // Derivative of the given order of a function of x = make_fvar(x0, radius), whose coefficients are held
+  // scaled by radius^order. Calculated as at(order) * order! / radius^order, one factor i/radius at a time,
+  // so that neither order! nor radius^order overflows on its own.
+  BOOST_AUTODIFF_CONSTEXPR RealType unscaled_derivative(root_type const& radius, size_t order) const;
 
-  const RealType& operator[](size_t) const;
+  BOOST_AUTODIFF_CONSTEXPR const RealType& operator[](size_t) const;
 
   fvar inverse() const;  // Multiplicative inverse.
 
-  fvar& negate();  // Negate and return reference to *this.
+  BOOST_AUTODIFF_CONSTEXPR fvar& negate();  // Negate and return reference to *this.
 
   static constexpr size_t depth = get_depth<fvar>::value;  // Number of nested std::array<RealType,Order>.
 
   static constexpr size_t order_sum = get_order_sum<fvar>::value;
 
-  explicit operator root_type() const;  // Must be explicit, otherwise overloaded operators are ambiguous.
+  // Must be explicit, otherwise overloaded operators are ambiguous.
+  BOOST_AUTODIFF_CONSTEXPR explicit operator root_type() const;
 
+  // Must be explicit; multiprecision has trouble without the std::enable_if
   template <typename T, typename = typename boost::enable_if<boost::is_arithmetic<decay_t<T>>>::type>
-  explicit operator T() const;  // Must be explicit; multiprecision has trouble without the std::enable_if
+  BOOST_AUTODIFF_CONSTEXPR explicit operator T() const;
 
-  fvar& set_root(root_type const&);
+  BOOST_AUTODIFF_CONSTEXPR fvar& set_root(root_type const&);
 
   // Apply coefficients using horner method.
   template <typename Func, typename Fvar, typename... Fvars>
@@ -333,7 +450,10 @@ class fvar {
                                                                     Fvars&&... fvars) const;
 
   template <typename Func>
-  fvar apply_coefficients(size_t const order, Func const& f) const;
+  fvar apply_coefficients(size_t const order, Func const& f) const&;
+
+  template <typename Func>
+  fvar apply_coefficients(size_t const order, Func const& f) &&;  // Reuses *this as epsilon.
 
   // Use when function returns derivative(i)/factorial(i) and may have some infinite derivatives.
   template <typename Func, typename Fvar, typename... Fvars>
@@ -343,7 +463,10 @@ class fvar {
                                                                               Fvars&&... fvars) const;
 
   template <typename Func>
-  fvar apply_coefficients_nonhorner(size_t const order, Func const& f) const;
+  fvar apply_coefficients_nonhorner(size_t const order, Func const& f) const&;
+
+  template <typename Func>
+  fvar apply_coefficients_nonhorner(size_t const order, Func const& f) &&;  // Reuses *this as epsilon.
 
   // Apply derivatives using horner method.
   template <typename Func, typename Fvar, typename... Fvars>
@@ -353,7 +476,10 @@ class fvar {
                                                                    Fvars&&... fvars) const;
 
   template <typename Func>
-  fvar apply_derivatives(size_t const order, Func const& f) const;
+  fvar apply_derivatives(size_t const order, Func const& f) const&;
+
+  template <typename Func>
+  fvar apply_derivatives(size_t const order, Func const& f) &&;  // Reuses *this as epsilon.
 
   // Use when function returns derivative(i) and may have some infinite derivatives.
   template <typename Func, typename Fvar, typename... Fvars>
@@ -363,7 +489,10 @@ class fvar {
                                                                              Fvars&&... fvars) const;
 
   template <typename Func>
-  fvar apply_derivatives_nonhorner(size_t const order, Func const& f) const;
+  fvar apply_derivatives_nonhorner(size_t const order, Func const& f) const&;
+
+  template <typename Func>
+  fvar apply_derivatives_nonhorner(size_t const order, Func const& f) &&;  // Reuses *this as epsilon.
 
  private:
   RealType epsilon_inner_product(size_t z0,
@@ -381,7 +510,7 @@ class fvar {
 
   fvar inverse_apply() const;
 
-  fvar& multiply_assign_by_root_type(bool is_root, root_type const&);
+  BOOST_AUTODIFF_CONSTEXPR fvar& multiply_assign_by_root_type(bool is_root, root_type const&);
 
   template <typename RealType2, size_t Orders2>
   friend class fvar;
@@ -389,6 +518,12 @@ class fvar {
   template <typename RealType2, size_t Order2>
   friend std::ostream& operator<<(std::ostream&, fvar<RealType2, Order2> const&);
 
+  template <typename RealType2, size_t Order2>
+  friend fvar<RealType2, Order2> fvar_inverse(fvar<RealType2, Order2> const&);
+
+  // Coefficient access for the Newton iterations of detail/autodiff_series.hpp in sqrt, log and exp.
+  friend struct fvar_series_access;
+
   // C++11 Compatibility
 #ifdef BOOST_NO_CXX17_IF_CONSTEXPR
   template <typename RootType>
@@ -445,6 +580,249 @@ class fvar {
 #endif
 };
 
+struct fvar_series_access {
+  template <typename RealType, size_t Order>
+  static RealType* data(fvar<RealType, Order>& r) {
+    return r.v.data();
+  }
+
+  template <typename RealType, size_t Order>
+  static RealType const* data(fvar<RealType, Order> const& r) {
+    return r.v.data();
+  }
+};
+
+// The extent of the coefficients that are not 0 is found on each call, rather than kept in the fvar, as the
+// coefficients are also written in place by the kernels and by fvar_series_access.
+
+// True if all terms of ca are 0.
+template <typename RealType>
+BOOST_AUTODIFF_CONSTEXPR bool is_zero(RealType const& ca) {
+  return ca == 0;
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR bool is_zero(fvar<RealType, Order> const& cr) {
+  for (size_t i = 0; i <= Order; ++i)
+    if (!is_zero(cr[i]))
+      return false;
+  return true;
+}
+
+// 1 + the index of the last coefficient of cr that is not 0, or 0 if cr is 0.
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR size_t nonzero_extent(fvar<RealType, Order> const& cr) {
+  size_t n = Order + 1;
+  while (0 < n && is_zero(cr[n - 1]))
+    --n;
+  return n;
+}
+
+// True if no term of ca is infinite or NaN, for which ca - ca is NaN.
+template <typename RealType>
+BOOST_AUTODIFF_CONSTEXPR bool is_finite(RealType const& ca) {
+  return ca - ca == 0;
+}
+
+// Same for the first n coefficients of cr.
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR bool is_finite(fvar<RealType, Order> const& cr, size_t n = Order + 1) {
+  for (size_t i = 0; i < n; ++i)
+    if (!is_finite(cr[i]))
+      return false;
+  return true;
+}
+
+// True if ca has no terms in any epsilon.
+template <typename RealType>
+BOOST_AUTODIFF_CONSTEXPR bool is_constant(RealType const&) {
+  return true;
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR bool is_constant(fvar<RealType, Order> const& cr) {
+  return nonzero_extent(cr) <= 1 && is_constant(cr[0]);
+}
+
+// True if a product of fvar<RealType, Order> whose factors have m and n coefficients up to their last that is
+// not 0 is summed over those only: always for a factor that is constant or an independent variable x0 + e,
+// with at most 2, and with BOOST_AUTODIFF_SKIP_ZEROS also for a product that ends before Order. Not for
+// Orders up to 1, which have nothing to skip, nor below BOOST_AUTODIFF_UNROLL_THRESHOLD for the kernels of
+// autodiff_simd.hpp, whose unrolled products of all coefficients are faster than any test of them.
+// Without BOOST_AUTODIFF_SKIP_ZEROS, the operators also check that the skipped 0s would only have multiplied
+// finite coefficients, so that infinities and NaNs propagate as in the loops over all coefficients.
+template <typename RealType, size_t Order>
+constexpr bool is_truncated_product(size_t m, size_t n) {
+  return 2 <= Order &&
+         !(simd::has_kernel<RealType, Order, RealType, Order>::value &&
+           simd::is_unrolled<Order + 1, RealType, RealType>::value) &&
+         (m <= 2 || n <= 2 || (skip_zeros::value && m + n <= Order + 1));
+}
+
+// Same for a quotient whose divisor has n coefficients up to its last that is not 0.
+template <typename RealType, size_t Order>
+constexpr bool is_truncated_divisor(size_t n) {
+  return 2 <= Order &&
+         !(simd::has_kernel<RealType, Order, RealType, Order>::value &&
+           simd::is_unrolled<Order + 1, RealType, RealType>::value) &&
+         (n <= 2 || (skip_zeros::value && n <= Order));
+}
+
+// True if cr1 * cr2 is summed as above, before the operators check that its coefficients are finite. Never
+// for factors of different types.
+template <typename RealType1, size_t Order1, typename RealType2, size_t Order2>
+BOOST_AUTODIFF_CONSTEXPR bool is_truncated_product(fvar<RealType1, Order1> const&,
+                                                   fvar<RealType2, Order2> const&) {
+  return false;
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR bool is_truncated_product(fvar<RealType, Order> const& cr1,
+                                                   fvar<RealType, Order> const& cr2) {
+  return is_truncated_product<RealType, Order>(nonzero_extent(cr1), nonzero_extent(cr2));
+}
+
+// True if cr1 / cr2 is solved as above. Never for operands of different types.
+template <typename RealType1, size_t Order1, typename RealType2, size_t Order2>
+BOOST_AUTODIFF_CONSTEXPR bool is_truncated_quotient(fvar<RealType1, Order1> const&,
+                                                    fvar<RealType2, Order2> const&) {
+  return false;
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR bool is_truncated_quotient(fvar<RealType, Order> const&,
+                                                    fvar<RealType, Order> const& cr2) {
+  return is_truncated_divisor<RealType, Order>(nonzero_extent(cr2));
+}
+
+// True with BOOST_AUTODIFF_SKIP_ZEROS if cr is constant, so that f(cr) is the constant f(x0).
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR bool is_skipped_constant(fvar<RealType, Order> const& cr) {
+  return skip_zeros::value && is_constant(cr);
+}
+
+// a *= c, except for a = 0, so that an infinite c does not make it NaN. autodiff_batch.hpp overloads it to
+// decide this for each lane.
+template <typename RealType>
+BOOST_AUTODIFF_CONSTEXPR void multiply_assign_nonzero(RealType& a, RealType const& c) {
+  if (a != 0)
+    a *= c;
+}
+
+// r += x * y, except for x = 0 or y = 0, and r += c * a, except for a = 0, as multiply_assign_nonzero() does.
+template <typename RealType>
+void add_product_nonzero(RealType& r, RealType const& x, RealType const& y) {
+  if (x != 0 && y != 0)
+    r += x * y;
+}
+
+template <typename RealType>
+void add_scaled_nonzero(RealType& r, RealType const& a, RealType const& c) {
+  if (a != 0)
+    r += c * a;
+}
+
+// Kernels for the functions of a nested fvar, which is a multivariate power series in the epsilons of all
+// depths, whose terms are of total degree up to order_sum. apply_coefficients() and apply_derivatives()
+// multiply by an epsilon whose root is 0, which raises the least degree of a product by 1. So only the terms
+// of degree up to order_sum-i of the i-th Horner step contribute to the result, and epsilon^i has no terms
+// below degree i. These compute only the terms that contribute, in place and without the temporary fvar of
+// each step, and skip the terms of epsilon that are 0, as for an independent variable.
+namespace nested {
+
+// r += x * y, skipping the products with a factor 0, so that an infinite term does not make them NaN.
+template <typename RealType>
+void add_product(RealType& r, RealType const& x, RealType const& y, size_t, size_t, size_t) {
+  if (fast_math::value)
+    r += x * y;
+  else
+    add_product_nonzero(r, x, y);
+}
+
+// r += x * y, of the terms of degree up to t, where the terms of x below degree zx and of y below degree zy
+// are 0. The product is summed into a temporary in the same order as by x * y, and then added to r.
+template <typename RealType, size_t Order>
+void add_product(fvar<RealType, Order>& r,
+                 fvar<RealType, Order> const& x,
+                 fvar<RealType, Order> const& y,
+                 size_t const zx,
+                 size_t const zy,
+                 size_t const t) {
+  if (skip_zeros::value && (is_zero(x) || is_zero(y)))
+    return;
+  constexpr size_t s = get_order_sum<RealType>::value;  // Greatest degree of the terms of each coefficient.
+  RealType const* const xv = fvar_series_access::data(x);
+  RealType const* const yv = fvar_series_access::data(y);
+  fvar<RealType, Order> p(0);
+  RealType* const pv = fvar_series_access::data(p);
+  size_t const k_max = t < Order ? t : Order;
+  for (size_t k = 0; k <= k_max; ++k)
+    for (size_t q = zy < s ? 0 : zy - s; q <= k; ++q)
+      if (zx <= k - q + s)
+        add_product(pv[k], yv[q], xv[k - q], zy < q ? 0 : zy - q, zx < k - q ? 0 : zx - (k - q), t - k);
+  r += p;
+}
+
+// r *= e in place, of the terms of degree up to t, where the root of e is 0 and the terms of r below degree z
+// are 0. Terms of r above degree t are left unspecified. r must not alias e.
+template <typename RealType, size_t Order>
+void multiply_assign(fvar<RealType, Order>& r, fvar<RealType, Order> const& e, size_t const z, size_t const t) {
+  constexpr size_t s = get_order_sum<RealType>::value;
+  RealType* const rv = fvar_series_access::data(r);
+  RealType const* const ev = fvar_series_access::data(e);
+  // Each coefficient rv[j] of the product depends on rv[0..j] of r, so they are computed in reverse. The terms
+  // are summed in the same order as by operator*=().
+  for (size_t j = t < Order ? t + 1 : Order + 1; j--;) {
+    if (j + s < z)
+      break;
+    RealType const rj = rv[j];
+    rv[j] = RealType(0);
+    for (size_t i = z < s ? 0 : z - s; i < j; ++i)
+      add_product(rv[j], rv[i], ev[j - i], z < i ? 0 : z - i, 0, t - j);
+    add_product(rv[j], rj, ev[0], z < j ? 0 : z - j, 1, t - j);
+  }
+}
+
+// r += c * a, skipping the terms of a that are 0, so that an infinite c does not make them NaN.
+template <typename RealType>
+void add_scaled(RealType& r, RealType const& a, RealType const& c) {
+  if (fast_math::value)
+    r += c * a;
+  else
+    add_scaled_nonzero(r, a, c);
+}
+
+template <typename RealType, size_t Order>
+void add_scaled(fvar<RealType, Order>& r,
+                fvar<RealType, Order> const& a,
+                typename fvar<RealType, Order>::root_type const& c) {
+  RealType* const rv = fvar_series_access::data(r);
+  RealType const* const av = fvar_series_access::data(a);
+  for (size_t i = 0; i <= Order; ++i)
+    add_scaled(rv[i], av[i], c);
+}
+
+}  // namespace nested
+
+// f(cr) of cr = x0 + x1*e + x2*e^2, which is f0 + f1*x1*e + (f1*x2 + f2*x1*x1)*e^2 for f0 = f(x0),
+// f1 = f'(x0) and f2() = f''(x0)/2, truncated to the Order of cr. f2 is called only for Order 2.
+// The functions that take this shortcut for is_closed_form skip the arrays of derivatives and the
+// recurrences.
+template <typename RealType, size_t Order, typename Func>
+fvar<RealType, Order> chain_rule(fvar<RealType, Order> const& cr,
+                                 typename fvar<RealType, Order>::root_type const& f0,
+                                 typename fvar<RealType, Order>::root_type const& f1,
+                                 Func const& f2) {
+  fvar<RealType, Order> retval(cr);
+  RealType* const v = fvar_series_access::data(retval);
+  v[0] = f0;
+  if (2 <= Order)  // Order is 1 or 2, except in branches compiled without if constexpr.
+    v[2] = f1 * v[2] + f2() * v[1] * v[1];
+  if (1 <= Order)
+    v[1] *= f1;
+  return retval;
+}
+
 // C++11 compatibility
 #ifdef BOOST_NO_CXX17_IF_CONSTEXPR
 #define BOOST_AUTODIFF_IF_CONSTEXPR
@@ -503,6 +881,24 @@ fvar<RealType, Order> frexp(fvar<RealType, Order> const&, int*);
 template <typename RealType, size_t Order>
 fvar<RealType, Order> ldexp(fvar<RealType, Order> const&, int);
 
+// fma(cr1, cr2, cr3) | RealType
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fma(fvar<RealType, Order> const&,
+                                                   fvar<RealType, Order> const&,
+                                                   fvar<RealType, Order>);
+
+// fma(cr1, ca, cr3) | RealType
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fma(fvar<RealType, Order> const&,
+                                                   typename fvar<RealType, Order>::root_type const&,
+                                                   fvar<RealType, Order>);
+
+// fma(ca, cr2, cr3) | RealType
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fma(typename fvar<RealType, Order>::root_type const&,
+                                                   fvar<RealType, Order> const&,
+                                                   fvar<RealType, Order>);
+
 // cos(cr1) | RealType
 template <typename RealType, size_t Order>
 fvar<RealType, Order> cos(fvar<RealType, Order> const&);
@@ -511,6 +907,10 @@ fvar<RealType, Order> cos(fvar<RealType, Order> const&);
 template <typename RealType, size_t Order>
 fvar<RealType, Order> sin(fvar<RealType, Order> const&);
 
+// sincos(cr1) | std::pair<RealType, RealType> | sin(cr1) and cos(cr1), computed together.
+template <typename RealType, size_t Order>
+std::pair<fvar<RealType, Order>, fvar<RealType, Order>> sincos(fvar<RealType, Order> const&);
+
 // asin(cr1) | RealType
 template <typename RealType, size_t Order>
 fvar<RealType, Order> asin(fvar<RealType, Order> const&);
@@ -606,6 +1006,10 @@ fvar<RealType, Order> sinc(fvar<RealType, Order> const&);
 template <typename RealType, size_t Order>
 fvar<RealType, Order> sinh(fvar<RealType, Order> const&);
 
+// sinh(cr1) and cosh(cr1), computed together.
+template <typename RealType, size_t Order>
+std::pair<fvar<RealType, Order>, fvar<RealType, Order>> sinhcosh(fvar<RealType, Order> const&);
+
 template <typename RealType, size_t Order>
 fvar<RealType, Order> tanh(fvar<RealType, Order> const&);
 
@@ -615,16 +1019,158 @@ fvar<RealType, Order> tgamma(fvar<RealType, Order> const&);
 template <size_t>
 struct zero : std::integral_constant<size_t, 0> {};
 
+// Factorials 0! ... N! and their inverses. Entries up to boost::math::max_factorial are exact, those beyond
+// are products that overflow to infinity, with inverse 0, rather than throw.
+template <typename RealType, size_t N>
+struct factorial_table {
+  using value_type = RealType;
+  std::array<RealType, N + 1> factorials;
+  std::array<RealType, N + 1> inverses;
+  factorial_table() {
+    for (size_t i = 0; i <= N; ++i) {
+      factorials[i] = i <= boost::math::max_factorial<RealType>::value
+                          ? boost::math::unchecked_factorial<RealType>(static_cast<unsigned>(i))
+                          : factorials[i - 1] * static_cast<RealType>(i);
+      inverses[i] = 1 / factorials[i];
+    }
+  }
+};
+
+// Binomial coefficients C(n,k) for 0 <= k <= n <= N, stored row by row as Pascal's triangle.
+template <typename RealType, size_t N>
+struct binomial_table {
+  using value_type = RealType;
+  std::array<RealType, (N + 1) * (N + 2) / 2> coefficients;
+  binomial_table() {
+    for (size_t n = 0, j = 0; n <= N; ++n)
+      for (size_t k = 0; k <= n; ++k, ++j)
+        coefficients[j] = k == 0 || k == n ? RealType(1) : coefficients[j - n - 1] + coefficients[j - n];
+  }
+  RealType const& operator()(size_t n, size_t k) const { return coefficients[n * (n + 1) / 2 + k]; }
+};
+
+// The single Table of each type, built on first use.
+template <typename Table>
+Table const& get_table(std::false_type) {
+  static Table const table;
+  return table;
+}
+
+// Multiprecision entries are built once per thread, since each costs big-number arithmetic and the
+// precision of some backends is a per-thread setting.
+template <typename Table>
+Table const& get_table(std::true_type) {
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+  static thread_local Table const table;
+#else
+  static Table const table;
+#endif
+  return table;
+}
+
+template <typename Table>
+Table const& get_table() {
+  using is_multiprecision =
+      std::integral_constant<bool, boost::multiprecision::is_number<typename Table::value_type>::value>;
+  return get_table<Table>(is_multiprecision());
+}
+
+// i! as a RootType, calculated in the lane type of RootType. Read from the table of 0! ... N!, otherwise
+// by boost::math::factorial(), which also serves the default N = 0.
+template <typename RootType, size_t N = 0>
+BOOST_AUTODIFF_CONSTEXPR RootType factorial(unsigned i) {
+  using lane_type = typename get_lane_type<RootType>::type;
+  if (BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+    lane_type retval(1);
+    for (unsigned j = 2; j <= i; ++j)
+      retval *= j;
+    return static_cast<RootType>(retval);
+  }
+  if (N < i)
+    return static_cast<RootType>(boost::math::factorial<lane_type>(i));
+  return static_cast<RootType>(get_table<factorial_table<lane_type, N>>().factorials[i]);
+}
+
+// 1 / i! as a RootType, so that an fvar is multiplied rather than divided by i!, coefficient by coefficient.
+template <typename RootType, size_t N = 0>
+BOOST_AUTODIFF_CONSTEXPR RootType inverse_factorial(unsigned i) {
+  using lane_type = typename get_lane_type<RootType>::type;
+  if (BOOST_AUTODIFF_IS_CONSTANT_EVALUATED() || N < i)
+    return static_cast<RootType>(1 / factorial<lane_type>(i));
+  return static_cast<RootType>(get_table<factorial_table<lane_type, N>>().inverses[i]);
+}
+
+// Binomial coefficient C(n,k) as a RootType, read from the table of n <= N.
+template <typename RootType, size_t N = 0>
+RootType binomial(size_t n, size_t k) {
+  using lane_type = typename get_lane_type<RootType>::type;
+  if (N < n)
+    return static_cast<RootType>(
+        boost::math::binomial_coefficient<lane_type>(static_cast<unsigned>(n), static_cast<unsigned>(k)));
+  return static_cast<RootType>(get_table<binomial_table<lane_type, N>>()(n, k));
+}
+
+// std::inner_product(), which is constexpr only as of C++20. Call as detail::inner_product() to avoid ADL.
+// init is taken by const&, since GCC notes a change of ABI for passing the 32-byte aligned batch<double,4>.
+template <typename InputIt1, typename InputIt2, typename T>
+BOOST_AUTODIFF_CONSTEXPR T inner_product(InputIt1 first1, InputIt1 last1, InputIt2 first2, T const& init) {
+  T acc = init;
+  for (; first1 != last1; ++first1, ++first2)
+    acc = acc + *first1 * *first2;
+  return acc;
+}
+
+// acc += a * b, recursing into fvar::add_product() for nested fvar coefficients.
+template <typename RealType, typename RealType1>
+BOOST_AUTODIFF_CONSTEXPR void multiply_accumulate(RealType& acc, RealType1 const& a, RealType const& b) {
+  acc += a * b;
+}
+
+template <typename RealType, size_t Order, typename RealType1>
+BOOST_AUTODIFF_CONSTEXPR void multiply_accumulate(fvar<RealType, Order>& acc,
+                                                  RealType1 const& a,
+                                                  fvar<RealType, Order> const& b) {
+  acc.add_product(a, b);
+}
+
+// acc += inner product of [first1, last1) and [first2, ...), likewise.
+template <typename RealType, typename InputIt1, typename InputIt2>
+BOOST_AUTODIFF_CONSTEXPR void multiply_accumulate(RealType& acc,
+                                                  InputIt1 first1,
+                                                  InputIt1 last1,
+                                                  InputIt2 first2) {
+  acc = detail::inner_product(first1, last1, first2, acc);
+}
+
+template <typename RealType, size_t Order, typename InputIt1, typename InputIt2>
+BOOST_AUTODIFF_CONSTEXPR void multiply_accumulate(fvar<RealType, Order>& acc,
+                                                  InputIt1 first1,
+                                                  InputIt1 last1,
+                                                  InputIt2 first2) {
+  for (; first1 != last1; ++first1, ++first2)
+    acc.add_product(*first1, *first2);
+}
+
 }  // namespace detail
 
 template <typename RealType, size_t Order, size_t... Orders>
 using autodiff_fvar = typename detail::nest_fvar<RealType, Order, Orders...>::type;
 
 template <typename RealType, size_t Order, size_t... Orders>
-autodiff_fvar<RealType, Order, Orders...> make_fvar(RealType const& ca) {
+BOOST_AUTODIFF_CONSTEXPR autodiff_fvar<RealType, Order, Orders...> make_fvar(RealType const& ca) {
   return autodiff_fvar<RealType, Order, Orders...>(ca, true);
 }
 
+// Independent variable x = ca + radius*e. The coefficients of x and of all functions of it are then held as
+// derivative(order)/order! * radius^order, which stay within the range of RealType at high Orders when the
+// Taylor coefficients themselves would overflow or underflow, e.g. at a radius near that of convergence.
+// Recover the derivatives with unscaled_derivative(radius, order).
+template <typename RealType, size_t Order, size_t... Orders>
+BOOST_AUTODIFF_CONSTEXPR autodiff_fvar<RealType, Order, Orders...> make_fvar(RealType const& ca,
+                                                                             RealType const& radius) {
+  return make_fvar<RealType, Order, Orders...>(RealType(0)) * radius + ca;
+}
+
 #ifndef BOOST_NO_CXX17_IF_CONSTEXPR
 namespace detail {
 
@@ -652,37 +1198,31 @@ namespace detail {
 
 #ifndef BOOST_NO_CXX17_IF_CONSTEXPR
 template <typename RealType, size_t Order>
-fvar<RealType, Order>::fvar(root_type const& ca, bool const is_variable) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>::fvar(root_type const& ca, bool const is_variable) : v{} {
   if constexpr (is_fvar<RealType>::value) {
     v.front() = RealType(ca, is_variable);
-    if constexpr (0 < Order)
-      std::fill(v.begin() + 1, v.end(), static_cast<RealType>(0));
   } else {
     v.front() = ca;
     if constexpr (0 < Order)
       v[1] = static_cast<root_type>(static_cast<int>(is_variable));
-    if constexpr (1 < Order)
-      std::fill(v.begin() + 2, v.end(), static_cast<RealType>(0));
   }
 }
 #endif
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-fvar<RealType, Order>::fvar(fvar<RealType2, Order2> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>::fvar(fvar<RealType2, Order2> const& cr) : v{} {
   for (size_t i = 0; i <= (std::min)(Order, Order2); ++i)
     v[i] = static_cast<RealType>(cr.v[i]);
-  if BOOST_AUTODIFF_IF_CONSTEXPR (Order2 < Order)
-    std::fill(v.begin() + (Order2 + 1), v.end(), static_cast<RealType>(0));
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order>::fvar(root_type const& ca) : v{{static_cast<RealType>(ca)}} {}
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>::fvar(root_type const& ca) : v{{static_cast<RealType>(ca)}} {}
 
 // Can cause compiler error if RealType2 cannot be cast to root_type.
 template <typename RealType, size_t Order>
 template <typename RealType2>
-fvar<RealType, Order>::fvar(RealType2 const& ca) : v{{static_cast<RealType>(ca)}} {}
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>::fvar(RealType2 const& ca) : v{{static_cast<RealType>(ca)}} {}
 
 template <typename RealType, size_t Order>
 fvar<RealType, Order>::fvar(char const* ca_str)
@@ -701,67 +1241,125 @@ fvar<RealType,Order>& fvar<RealType,Order>::operator=(root_type const& ca)
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-fvar<RealType, Order>& fvar<RealType, Order>::operator+=(fvar<RealType2, Order2> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::operator+=(
+    fvar<RealType2, Order2> const& cr) {
   for (size_t i = 0; i <= (std::min)(Order, Order2); ++i)
     v[i] += cr.v[i];
   return *this;
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order>& fvar<RealType, Order>::operator+=(root_type const& ca) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::operator+=(root_type const& ca) {
   v.front() += ca;
   return *this;
 }
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-fvar<RealType, Order>& fvar<RealType, Order>::operator-=(fvar<RealType2, Order2> const& cr) {
-  for (size_t i = 0; i <= Order; ++i)
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::operator-=(
+    fvar<RealType2, Order2> const& cr) {
+  for (size_t i = 0; i <= (std::min)(Order, Order2); ++i)
     v[i] -= cr.v[i];
   return *this;
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order>& fvar<RealType, Order>::operator-=(root_type const& ca) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::operator-=(root_type const& ca) {
   v.front() -= ca;
   return *this;
 }
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-fvar<RealType, Order>& fvar<RealType, Order>::operator*=(fvar<RealType2, Order2> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::operator*=(
+    fvar<RealType2, Order2> const& cr) {
   using diff_t = typename std::array<RealType, Order + 1>::difference_type;
   promote<RealType, RealType2> const zero(0);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (std::is_same<fvar, fvar<RealType2, Order2>>::value) {
+    size_t const m = nonzero_extent(*this);
+    size_t const n = nonzero_extent(cr);
+    if (is_truncated_product<RealType, Order>(m, n) &&
+        (skip_zeros::value || (is_finite(*this, m) && is_finite(cr, n))))
+      return *this = *this * cr;
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (series::has_fast_multiply<RealType, Order, RealType2, Order2>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+      if (static_cast<void const*>(&cr) == static_cast<void const*>(this))
+        return *this = *this * cr;
+      series::multiply_assign<Order + 1>(
+          series::has_fast_multiply<RealType, Order, RealType2, Order2>{}, v.data(), cr.v.data());
+      return *this;
+    }
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (simd::has_kernel<RealType, Order, RealType2, Order2>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+      if (static_cast<void const*>(&cr) == static_cast<void const*>(this))
+        return *this = *this * cr;
+      simd::multiply_assign(simd::size_constant<Order + 1>{}, v.data(), cr.v.data());
+      return *this;
+    }
+  }
   if BOOST_AUTODIFF_IF_CONSTEXPR (Order <= Order2)
     for (size_t i = 0, j = Order; i <= Order; ++i, --j)
-      v[j] = std::inner_product(v.cbegin(), v.cend() - diff_t(i), cr.v.crbegin() + diff_t(i), zero);
+      v[j] = detail::inner_product(v.cbegin(), v.cend() - diff_t(i), cr.v.crbegin() + diff_t(i), zero);
   else {
     for (size_t i = 0, j = Order; i <= Order - Order2; ++i, --j)
-      v[j] = std::inner_product(cr.v.cbegin(), cr.v.cend(), v.crbegin() + diff_t(i), zero);
+      v[j] = detail::inner_product(cr.v.cbegin(), cr.v.cend(), v.crbegin() + diff_t(i), zero);
     for (size_t i = Order - Order2 + 1, j = Order2 - 1; i <= Order; ++i, --j)
-      v[j] = std::inner_product(cr.v.cbegin(), cr.v.cbegin() + diff_t(j + 1), v.crbegin() + diff_t(i), zero);
+      v[j] =
+          detail::inner_product(cr.v.cbegin(), cr.v.cbegin() + diff_t(j + 1), v.crbegin() + diff_t(i), zero);
   }
   return *this;
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order>& fvar<RealType, Order>::operator*=(root_type const& ca) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::operator*=(root_type const& ca) {
   return multiply_assign_by_root_type(true, ca);
 }
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-fvar<RealType, Order>& fvar<RealType, Order>::operator/=(fvar<RealType2, Order2> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::operator/=(
+    fvar<RealType2, Order2> const& cr) {
   using diff_t = typename std::array<RealType, Order + 1>::difference_type;
   RealType const zero(0);
+  if (is_truncated_quotient(*this, cr)) {  // See operator/().
+    if (!skip_zeros::value || static_cast<void const*>(&cr) == static_cast<void const*>(this))
+      return *this = *this / cr;
+    size_t const n = nonzero_extent(cr);
+    for (size_t k = 0; k <= Order; ++k) {
+      RealType sum = zero;
+      for (size_t j = 1; j <= k && j < n; ++j)
+        sum += cr.v[j] * v[k - j];
+      (v[k] -= sum) /= cr.v.front();
+    }
+    return *this;
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (series::has_fast_multiply<RealType, Order, RealType2, Order2>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+      if (static_cast<void const*>(&cr) == static_cast<void const*>(this))
+        return *this = *this / cr;
+      series::divide_assign<Order + 1>(
+          series::has_fast_multiply<RealType, Order, RealType2, Order2>{}, v.data(), cr.v.data());
+      return *this;
+    }
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (simd::has_kernel<RealType, Order, RealType2, Order2>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+      if (static_cast<void const*>(&cr) == static_cast<void const*>(this))
+        return *this = *this / cr;
+      simd::divide_assign(simd::size_constant<Order + 1>{}, v.data(), cr.v.data());
+      return *this;
+    }
+  }
   v.front() /= cr.v.front();
   if BOOST_AUTODIFF_IF_CONSTEXPR (Order < Order2)
     for (size_t i = 1, j = Order2 - 1, k = Order; i <= Order; ++i, --j, --k)
-      (v[i] -= std::inner_product(
+      (v[i] -= detail::inner_product(
            cr.v.cbegin() + 1, cr.v.cend() - diff_t(j), v.crbegin() + diff_t(k), zero)) /= cr.v.front();
   else if BOOST_AUTODIFF_IF_CONSTEXPR (0 < Order2)
     for (size_t i = 1, j = Order2 - 1, k = Order; i <= Order; ++i, j && --j, --k)
-      (v[i] -= std::inner_product(
+      (v[i] -= detail::inner_product(
            cr.v.cbegin() + 1, cr.v.cend() - diff_t(j), v.crbegin() + diff_t(k), zero)) /= cr.v.front();
   else
     for (size_t i = 1; i <= Order; ++i)
@@ -770,28 +1368,67 @@ fvar<RealType, Order>& fvar<RealType, Order>::operator/=(fvar<RealType2, Order2>
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order>& fvar<RealType, Order>::operator/=(root_type const& ca) {
-  std::for_each(v.begin(), v.end(), [&ca](RealType& x) { x /= ca; });
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::operator/=(root_type const& ca) {
+  for (RealType& x : v)
+    x /= ca;
   return *this;
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order> fvar<RealType, Order>::operator-() const {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::add_product(fvar const& cr1,
+                                                                                   fvar const& cr2) {
+  if (&cr1 == this || &cr2 == this)
+    return *this += cr1 * cr2;
+  // The subquadratic products outweigh the saved temporary.
+  if BOOST_AUTODIFF_IF_CONSTEXPR (series::has_fast_multiply<RealType, Order, RealType, Order>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED())
+      return *this += cr1 * cr2;
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (simd::has_kernel<RealType, Order, RealType, Order>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+      simd::multiply_add(simd::size_constant<Order + 1>{}, v.data(), cr1.v.data(), cr2.v.data());
+      return *this;
+    }
+  }
+  using diff_t = typename std::array<RealType, Order + 1>::difference_type;
+  for (size_t i = 0; i <= Order; ++i)
+    multiply_accumulate(
+        v[i], cr1.v.cbegin(), cr1.v.cbegin() + diff_t(i + 1), cr2.v.crbegin() + diff_t(Order - i));
+  return *this;
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::add_product(root_type const& ca,
+                                                                                   fvar const& cr) {
+  if (&cr == this)
+    return *this *= ca + 1;
+  for (size_t i = 0; i <= Order; ++i)
+    multiply_accumulate(v[i], ca, cr.v[i]);
+  return *this;
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fvar<RealType, Order>::operator-() const& {
   fvar<RealType, Order> retval(*this);
   retval.negate();
   return retval;
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order> const& fvar<RealType, Order>::operator+() const {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fvar<RealType, Order>::operator-() && {
+  return std::move(negate());
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> const& fvar<RealType, Order>::operator+() const {
   return *this;
 }
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-promote<fvar<RealType, Order>, fvar<RealType2, Order2>> fvar<RealType, Order>::operator+(
-    fvar<RealType2, Order2> const& cr) const {
-  promote<fvar<RealType, Order>, fvar<RealType2, Order2>> retval;
+BOOST_AUTODIFF_CONSTEXPR promote<fvar<RealType, Order>, fvar<RealType2, Order2>>
+fvar<RealType, Order>::operator+(fvar<RealType2, Order2> const& cr) const& {
+  promote<fvar<RealType, Order>, fvar<RealType2, Order2>> retval{};
   for (size_t i = 0; i <= (std::min)(Order, Order2); ++i)
     retval.v[i] = v[i] + cr.v[i];
   if BOOST_AUTODIFF_IF_CONSTEXPR (Order < Order2)
@@ -804,23 +1441,23 @@ promote<fvar<RealType, Order>, fvar<RealType2, Order2>> fvar<RealType, Order>::o
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order> fvar<RealType, Order>::operator+(root_type const& ca) const {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fvar<RealType, Order>::operator+(root_type const& ca) const& {
   fvar<RealType, Order> retval(*this);
   retval.v.front() += ca;
   return retval;
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order> operator+(typename fvar<RealType, Order>::root_type const& ca,
-                                fvar<RealType, Order> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator+(typename fvar<RealType, Order>::root_type const& ca,
+                                                         fvar<RealType, Order> const& cr) {
   return cr + ca;
 }
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-promote<fvar<RealType, Order>, fvar<RealType2, Order2>> fvar<RealType, Order>::operator-(
-    fvar<RealType2, Order2> const& cr) const {
-  promote<fvar<RealType, Order>, fvar<RealType2, Order2>> retval;
+BOOST_AUTODIFF_CONSTEXPR promote<fvar<RealType, Order>, fvar<RealType2, Order2>>
+fvar<RealType, Order>::operator-(fvar<RealType2, Order2> const& cr) const& {
+  promote<fvar<RealType, Order>, fvar<RealType2, Order2>> retval{};
   for (size_t i = 0; i <= (std::min)(Order, Order2); ++i)
     retval.v[i] = v[i] - cr.v[i];
   if BOOST_AUTODIFF_IF_CONSTEXPR (Order < Order2)
@@ -833,15 +1470,15 @@ promote<fvar<RealType, Order>, fvar<RealType2, Order2>> fvar<RealType, Order>::o
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order> fvar<RealType, Order>::operator-(root_type const& ca) const {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fvar<RealType, Order>::operator-(root_type const& ca) const& {
   fvar<RealType, Order> retval(*this);
   retval.v.front() -= ca;
   return retval;
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order> operator-(typename fvar<RealType, Order>::root_type const& ca,
-                                fvar<RealType, Order> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator-(typename fvar<RealType, Order>::root_type const& ca,
+                                                         fvar<RealType, Order> const& cr) {
   fvar<RealType, Order> mcr = -cr;  // Has same address as retval in operator-() due to NRVO.
   mcr += ca;
   return mcr;  // <-- This allows for NRVO. The following does not. --> return mcr += ca;
@@ -849,56 +1486,118 @@ fvar<RealType, Order> operator-(typename fvar<RealType, Order>::root_type const&
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-promote<fvar<RealType, Order>, fvar<RealType2, Order2>> fvar<RealType, Order>::operator*(
-    fvar<RealType2, Order2> const& cr) const {
+BOOST_AUTODIFF_CONSTEXPR promote<fvar<RealType, Order>, fvar<RealType2, Order2>>
+fvar<RealType, Order>::operator*(fvar<RealType2, Order2> const& cr) const& {
   using diff_t = typename std::array<RealType, Order + 1>::difference_type;
   promote<RealType, RealType2> const zero(0);
-  promote<fvar<RealType, Order>, fvar<RealType2, Order2>> retval;
+  promote<fvar<RealType, Order>, fvar<RealType2, Order2>> retval{};
+  if BOOST_AUTODIFF_IF_CONSTEXPR (std::is_same<fvar, fvar<RealType2, Order2>>::value) {
+    // If the factors have m and n coefficients up to their last that is not 0, then the product has m+n-1.
+    // These sum only the products of the first m and n, in the same order as the loops below, which is
+    // O(Order) for a constant or an independent variable x0 + e. See is_truncated_product().
+    size_t const m = nonzero_extent(*this);
+    size_t const n = nonzero_extent(cr);
+    if (is_truncated_product<RealType, Order>(m, n) &&
+        (skip_zeros::value || (is_finite(*this, m) && is_finite(cr, n)))) {
+      for (size_t k = 0; k + 1 < m + n && k <= Order; ++k)
+        for (size_t t = k < m ? 0 : k + 1 - m; t < n && t <= k; ++t)
+          retval.v[k] += cr.v[t] * v[k - t];
+      return retval;
+    }
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (series::has_fast_multiply<RealType, Order, RealType2, Order2>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+      series::multiply<Order + 1>(series::has_fast_multiply<RealType, Order, RealType2, Order2>{},
+                                  retval.v.data(),
+                                  v.data(),
+                                  cr.v.data());
+      return retval;
+    }
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (simd::has_kernel<RealType, Order, RealType2, Order2>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+      simd::multiply(simd::size_constant<Order + 1>{}, retval.v.data(), v.data(), cr.v.data());
+      return retval;
+    }
+  }
   if BOOST_AUTODIFF_IF_CONSTEXPR (Order < Order2)
     for (size_t i = 0, j = Order, k = Order2; i <= Order2; ++i, j && --j, --k)
-      retval.v[i] = std::inner_product(v.cbegin(), v.cend() - diff_t(j), cr.v.crbegin() + diff_t(k), zero);
+      retval.v[i] = detail::inner_product(v.cbegin(), v.cend() - diff_t(j), cr.v.crbegin() + diff_t(k), zero);
   else
     for (size_t i = 0, j = Order2, k = Order; i <= Order; ++i, j && --j, --k)
-      retval.v[i] = std::inner_product(cr.v.cbegin(), cr.v.cend() - diff_t(j), v.crbegin() + diff_t(k), zero);
+      retval.v[i] =
+          detail::inner_product(cr.v.cbegin(), cr.v.cend() - diff_t(j), v.crbegin() + diff_t(k), zero);
   return retval;
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order> fvar<RealType, Order>::operator*(root_type const& ca) const {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fvar<RealType, Order>::operator*(root_type const& ca) const& {
   fvar<RealType, Order> retval(*this);
   retval *= ca;
   return retval;
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order> operator*(typename fvar<RealType, Order>::root_type const& ca,
-                                fvar<RealType, Order> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator*(typename fvar<RealType, Order>::root_type const& ca,
+                                                         fvar<RealType, Order> const& cr) {
   return cr * ca;
 }
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-promote<fvar<RealType, Order>, fvar<RealType2, Order2>> fvar<RealType, Order>::operator/(
-    fvar<RealType2, Order2> const& cr) const {
+BOOST_AUTODIFF_CONSTEXPR promote<fvar<RealType, Order>, fvar<RealType2, Order2>>
+fvar<RealType, Order>::operator/(fvar<RealType2, Order2> const& cr) const& {
   using diff_t = typename std::array<RealType, Order + 1>::difference_type;
   promote<RealType, RealType2> const zero(0);
-  promote<fvar<RealType, Order>, fvar<RealType2, Order2>> retval;
+  promote<fvar<RealType, Order>, fvar<RealType2, Order2>> retval{};
+  if BOOST_AUTODIFF_IF_CONSTEXPR (std::is_same<fvar, fvar<RealType2, Order2>>::value) {
+    // Forward substitution over the n coefficients of the divisor up to its last that is not 0, in the same
+    // order as the loops below, which is O(Order) for a constant or an independent variable x0 + e.
+    size_t const n = nonzero_extent(cr);
+    if (is_truncated_divisor<RealType, Order>(n)) {
+      for (size_t k = 0; k <= Order; ++k) {
+        promote<RealType, RealType2> sum = zero;
+        for (size_t j = 1; j <= k && j < n; ++j)
+          sum += cr.v[j] * retval.v[k - j];
+        retval.v[k] = (v[k] - sum) / cr.v.front();
+      }
+      // Otherwise the skipped 0s of the divisor multiply an infinite or NaN coefficient of the quotient.
+      if (skip_zeros::value || is_finite(retval))
+        return retval;
+      retval = {};
+    }
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (series::has_fast_multiply<RealType, Order, RealType2, Order2>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+      series::divide<Order + 1>(series::has_fast_multiply<RealType, Order, RealType2, Order2>{},
+                                retval.v.data(),
+                                v.data(),
+                                cr.v.data());
+      return retval;
+    }
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (simd::has_kernel<RealType, Order, RealType2, Order2>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+      simd::divide(simd::size_constant<Order + 1>{}, retval.v.data(), v.data(), cr.v.data());
+      return retval;
+    }
+  }
   retval.v.front() = v.front() / cr.v.front();
   if BOOST_AUTODIFF_IF_CONSTEXPR (Order < Order2) {
     for (size_t i = 1, j = Order2 - 1; i <= Order; ++i, --j)
       retval.v[i] =
-          (v[i] - std::inner_product(
+          (v[i] - detail::inner_product(
                       cr.v.cbegin() + 1, cr.v.cend() - diff_t(j), retval.v.crbegin() + diff_t(j + 1), zero)) /
           cr.v.front();
     for (size_t i = Order + 1, j = Order2 - Order - 1; i <= Order2; ++i, --j)
       retval.v[i] =
-          -std::inner_product(
+          -detail::inner_product(
               cr.v.cbegin() + 1, cr.v.cend() - diff_t(j), retval.v.crbegin() + diff_t(j + 1), zero) /
           cr.v.front();
   } else if BOOST_AUTODIFF_IF_CONSTEXPR (0 < Order2)
     for (size_t i = 1, j = Order2 - 1, k = Order; i <= Order; ++i, j && --j, --k)
       retval.v[i] =
-          (v[i] - std::inner_product(
+          (v[i] - detail::inner_product(
                       cr.v.cbegin() + 1, cr.v.cend() - diff_t(j), retval.v.crbegin() + diff_t(k), zero)) /
           cr.v.front();
   else
@@ -908,122 +1607,288 @@ promote<fvar<RealType, Order>, fvar<RealType2, Order2>> fvar<RealType, Order>::o
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order> fvar<RealType, Order>::operator/(root_type const& ca) const {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fvar<RealType, Order>::operator/(root_type const& ca) const& {
   fvar<RealType, Order> retval(*this);
   retval /= ca;
   return retval;
 }
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order> operator/(typename fvar<RealType, Order>::root_type const& ca,
-                                fvar<RealType, Order> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator/(typename fvar<RealType, Order>::root_type const& ca,
+                                                         fvar<RealType, Order> const& cr) {
   using diff_t = typename std::array<RealType, Order + 1>::difference_type;
-  fvar<RealType, Order> retval;
+  fvar<RealType, Order> retval{};
+  size_t const n = nonzero_extent(cr);
+  if (is_truncated_divisor<RealType, Order>(n)) {  // See operator/().
+    RealType const zero(0);
+    retval.v.front() = ca / cr.v.front();
+    for (size_t k = 1; k <= Order; ++k) {
+      RealType sum = zero;
+      for (size_t j = 1; j <= k && j < n; ++j)
+        sum += cr.v[j] * retval.v[k - j];
+      retval.v[k] = -sum / cr.v.front();
+    }
+    if (skip_zeros::value || is_finite(retval))
+      return retval;
+    retval = {};
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (series::has_fast_multiply<RealType, Order, RealType, Order>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+      retval.v.front() = ca;
+      series::divide_assign<Order + 1>(
+          series::has_fast_multiply<RealType, Order, RealType, Order>{}, retval.v.data(), cr.v.data());
+      return retval;
+    }
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (simd::has_kernel<RealType, Order, RealType, Order>::value) {
+    if (!BOOST_AUTODIFF_IS_CONSTANT_EVALUATED()) {
+      retval.v.front() = ca;
+      simd::divide_assign(simd::size_constant<Order + 1>{}, retval.v.data(), cr.v.data());
+      return retval;
+    }
+  }
   retval.v.front() = ca / cr.v.front();
   if BOOST_AUTODIFF_IF_CONSTEXPR (0 < Order) {
     RealType const zero(0);
     for (size_t i = 1, j = Order - 1; i <= Order; ++i, --j)
       retval.v[i] =
-          -std::inner_product(
+          -detail::inner_product(
               cr.v.cbegin() + 1, cr.v.cend() - diff_t(j), retval.v.crbegin() + diff_t(j + 1), zero) /
           cr.v.front();
   }
   return retval;
 }
 
+// Binary operators with an fvar&& operand compute the result in place of that operand, which is then moved
+// into the return value. This saves a copy of every coefficient when the operand is a temporary, such as
+// the result of a previous operator or function, and is what makes chained expressions of heap-backed
+// root_types cheap. An fvar&& operand is reused only when its type is the type of the result, and not for
+// a truncated product or quotient, which is written to a new fvar in any case and is then returned
+// without the move.
+
+// Fvar, if it is the type of the result of a binary operator on Fvar and Other.
+template <typename Fvar, typename Other>
+using enable_if_promoted =
+    typename std::enable_if<std::is_same<promote<Fvar, Other>, Fvar>::value, Fvar>::type;
+
+template <typename RealType1, size_t Order1, typename RealType2, size_t Order2>
+BOOST_AUTODIFF_CONSTEXPR enable_if_promoted<fvar<RealType1, Order1>, fvar<RealType2, Order2>> operator+(
+    fvar<RealType1, Order1>&& cr1,
+    fvar<RealType2, Order2> const& cr2) {
+  return std::move(cr1 += cr2);
+}
+
+template <typename RealType1, size_t Order1, typename RealType2, size_t Order2>
+BOOST_AUTODIFF_CONSTEXPR enable_if_promoted<fvar<RealType2, Order2>, fvar<RealType1, Order1>> operator+(
+    fvar<RealType1, Order1> const& cr1,
+    fvar<RealType2, Order2>&& cr2) {
+  return std::move(cr2 += cr1);
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator+(fvar<RealType, Order>&& cr1,
+                                                         fvar<RealType, Order>&& cr2) {
+  return std::move(cr1 += cr2);
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator+(
+    fvar<RealType, Order>&& cr,
+    typename fvar<RealType, Order>::root_type const& ca) {
+  return std::move(cr += ca);
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator+(typename fvar<RealType, Order>::root_type const& ca,
+                                                         fvar<RealType, Order>&& cr) {
+  return std::move(cr += ca);
+}
+
+// The difference is computed in place of the minuend only. In place of the subtrahend, it would be negated
+// first, which costs as much as the difference written to a new fvar by the const& operator.
+template <typename RealType1, size_t Order1, typename RealType2, size_t Order2>
+BOOST_AUTODIFF_CONSTEXPR enable_if_promoted<fvar<RealType1, Order1>, fvar<RealType2, Order2>> operator-(
+    fvar<RealType1, Order1>&& cr1,
+    fvar<RealType2, Order2> const& cr2) {
+  return std::move(cr1 -= cr2);
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator-(fvar<RealType, Order>&& cr1,
+                                                         fvar<RealType, Order>&& cr2) {
+  return std::move(cr1 -= cr2);
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator-(
+    fvar<RealType, Order>&& cr,
+    typename fvar<RealType, Order>::root_type const& ca) {
+  return std::move(cr -= ca);
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator-(typename fvar<RealType, Order>::root_type const& ca,
+                                                         fvar<RealType, Order>&& cr) {
+  return std::move(cr.negate() += ca);
+}
+
+template <typename RealType1, size_t Order1, typename RealType2, size_t Order2>
+BOOST_AUTODIFF_CONSTEXPR enable_if_promoted<fvar<RealType1, Order1>, fvar<RealType2, Order2>> operator*(
+    fvar<RealType1, Order1>&& cr1,
+    fvar<RealType2, Order2> const& cr2) {
+  if (is_truncated_product(cr1, cr2))
+    return cr1 * cr2;
+  return std::move(cr1 *= cr2);
+}
+
+template <typename RealType1, size_t Order1, typename RealType2, size_t Order2>
+BOOST_AUTODIFF_CONSTEXPR enable_if_promoted<fvar<RealType2, Order2>, fvar<RealType1, Order1>> operator*(
+    fvar<RealType1, Order1> const& cr1,
+    fvar<RealType2, Order2>&& cr2) {
+  if (is_truncated_product(cr2, cr1))
+    return cr2 * cr1;
+  return std::move(cr2 *= cr1);
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator*(fvar<RealType, Order>&& cr1,
+                                                         fvar<RealType, Order>&& cr2) {
+  if (is_truncated_product(cr1, cr2))
+    return cr1 * cr2;
+  return std::move(cr1 *= cr2);
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator*(
+    fvar<RealType, Order>&& cr,
+    typename fvar<RealType, Order>::root_type const& ca) {
+  return std::move(cr *= ca);
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator*(typename fvar<RealType, Order>::root_type const& ca,
+                                                         fvar<RealType, Order>&& cr) {
+  return std::move(cr *= ca);
+}
+
+// The quotient is computed in place of the dividend only, as each coefficient of the quotient depends on the
+// coefficients of the divisor.
+template <typename RealType1, size_t Order1, typename RealType2, size_t Order2>
+BOOST_AUTODIFF_CONSTEXPR enable_if_promoted<fvar<RealType1, Order1>, fvar<RealType2, Order2>> operator/(
+    fvar<RealType1, Order1>&& cr1,
+    fvar<RealType2, Order2> const& cr2) {
+  if (static_cast<void const*>(&cr1) == static_cast<void const*>(&cr2) ||
+      (!skip_zeros::value && is_truncated_quotient(cr1, cr2)))
+    return cr1 / cr2;
+  return std::move(cr1 /= cr2);
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> operator/(
+    fvar<RealType, Order>&& cr,
+    typename fvar<RealType, Order>::root_type const& ca) {
+  return std::move(cr /= ca);
+}
+
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-bool fvar<RealType, Order>::operator==(fvar<RealType2, Order2> const& cr) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator==(fvar<RealType2, Order2> const& cr) const {
   return v.front() == cr.v.front();
 }
 
 template <typename RealType, size_t Order>
-bool fvar<RealType, Order>::operator==(root_type const& ca) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator==(root_type const& ca) const {
   return v.front() == ca;
 }
 
 template <typename RealType, size_t Order>
-bool operator==(typename fvar<RealType, Order>::root_type const& ca, fvar<RealType, Order> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR bool operator==(typename fvar<RealType, Order>::root_type const& ca,
+                                         fvar<RealType, Order> const& cr) {
   return ca == cr.v.front();
 }
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-bool fvar<RealType, Order>::operator!=(fvar<RealType2, Order2> const& cr) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator!=(fvar<RealType2, Order2> const& cr) const {
   return v.front() != cr.v.front();
 }
 
 template <typename RealType, size_t Order>
-bool fvar<RealType, Order>::operator!=(root_type const& ca) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator!=(root_type const& ca) const {
   return v.front() != ca;
 }
 
 template <typename RealType, size_t Order>
-bool operator!=(typename fvar<RealType, Order>::root_type const& ca, fvar<RealType, Order> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR bool operator!=(typename fvar<RealType, Order>::root_type const& ca,
+                                         fvar<RealType, Order> const& cr) {
   return ca != cr.v.front();
 }
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-bool fvar<RealType, Order>::operator<=(fvar<RealType2, Order2> const& cr) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator<=(fvar<RealType2, Order2> const& cr) const {
   return v.front() <= cr.v.front();
 }
 
 template <typename RealType, size_t Order>
-bool fvar<RealType, Order>::operator<=(root_type const& ca) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator<=(root_type const& ca) const {
   return v.front() <= ca;
 }
 
 template <typename RealType, size_t Order>
-bool operator<=(typename fvar<RealType, Order>::root_type const& ca, fvar<RealType, Order> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR bool operator<=(typename fvar<RealType, Order>::root_type const& ca,
+                                         fvar<RealType, Order> const& cr) {
   return ca <= cr.v.front();
 }
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-bool fvar<RealType, Order>::operator>=(fvar<RealType2, Order2> const& cr) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator>=(fvar<RealType2, Order2> const& cr) const {
   return v.front() >= cr.v.front();
 }
 
 template <typename RealType, size_t Order>
-bool fvar<RealType, Order>::operator>=(root_type const& ca) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator>=(root_type const& ca) const {
   return v.front() >= ca;
 }
 
 template <typename RealType, size_t Order>
-bool operator>=(typename fvar<RealType, Order>::root_type const& ca, fvar<RealType, Order> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR bool operator>=(typename fvar<RealType, Order>::root_type const& ca,
+                                         fvar<RealType, Order> const& cr) {
   return ca >= cr.v.front();
 }
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-bool fvar<RealType, Order>::operator<(fvar<RealType2, Order2> const& cr) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator<(fvar<RealType2, Order2> const& cr) const {
   return v.front() < cr.v.front();
 }
 
 template <typename RealType, size_t Order>
-bool fvar<RealType, Order>::operator<(root_type const& ca) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator<(root_type const& ca) const {
   return v.front() < ca;
 }
 
 template <typename RealType, size_t Order>
-bool operator<(typename fvar<RealType, Order>::root_type const& ca, fvar<RealType, Order> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR bool operator<(typename fvar<RealType, Order>::root_type const& ca,
+                                        fvar<RealType, Order> const& cr) {
   return ca < cr.v.front();
 }
 
 template <typename RealType, size_t Order>
 template <typename RealType2, size_t Order2>
-bool fvar<RealType, Order>::operator>(fvar<RealType2, Order2> const& cr) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator>(fvar<RealType2, Order2> const& cr) const {
   return v.front() > cr.v.front();
 }
 
 template <typename RealType, size_t Order>
-bool fvar<RealType, Order>::operator>(root_type const& ca) const {
+BOOST_AUTODIFF_CONSTEXPR bool fvar<RealType, Order>::operator>(root_type const& ca) const {
   return v.front() > ca;
 }
 
 template <typename RealType, size_t Order>
-bool operator>(typename fvar<RealType, Order>::root_type const& ca, fvar<RealType, Order> const& cr) {
+BOOST_AUTODIFF_CONSTEXPR bool operator>(typename fvar<RealType, Order>::root_type const& ca,
+                                        fvar<RealType, Order> const& cr) {
   return ca > cr.v.front();
 }
 
@@ -1054,16 +1919,44 @@ promote<fvar<RealType, Order>, Fvar, Fvars...> fvar<RealType, Order>::apply_coef
 // Use this when you have the polynomial coefficients, rather than just the derivatives. E.g. See atan().
 template <typename RealType, size_t Order>
 template <typename Func>
-fvar<RealType, Order> fvar<RealType, Order>::apply_coefficients(size_t const order, Func const& f) const {
-  fvar<RealType, Order> const epsilon = fvar<RealType, Order>(*this).set_root(0);
+fvar<RealType, Order> fvar<RealType, Order>::apply_coefficients(size_t const order, Func const& f) const& {
+  if (is_skipped_constant(*this))
+    return fvar<RealType, Order>(f(0));
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar>::value)
+    return chain_rule(*this, f(0), 0 < order ? f(1) : root_type(0), [&f, order] {
+      return 1 < order ? f(2) : root_type(0);
+    });
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+#ifndef BOOST_NO_CXX17_IF_CONSTEXPR
+    size_t const m = (std::min)(order, order_sum);
+#else  // ODR-use of static constexpr
+    size_t const m = order < order_sum ? order : order_sum;
+#endif
+    fvar<RealType, Order> retval;
+    series::compose<Order + 1>(retval.v.data(), v.data(), Order + 1, m, f);
+    return retval;
+  }
+  return fvar<RealType, Order>(*this).apply_coefficients(order, f);
+}
+
+template <typename RealType, size_t Order>
+template <typename Func>
+fvar<RealType, Order> fvar<RealType, Order>::apply_coefficients(size_t const order, Func const& f) && {
+  if (is_skipped_constant(*this))
+    return fvar<RealType, Order>(f(0));
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value)
+    return static_cast<fvar<RealType, Order> const&>(*this).apply_coefficients(order, f);
+  fvar<RealType, Order> const& epsilon = set_root(0);
 #ifndef BOOST_NO_CXX17_IF_CONSTEXPR
   size_t i = (std::min)(order, order_sum);
 #else  // ODR-use of static constexpr
   size_t i = order < order_sum ? order : order_sum;
 #endif
   fvar<RealType, Order> accumulator = f(i);
-  while (i--)
-    (accumulator *= epsilon) += f(i);
+  while (i--) {
+    nested::multiply_assign(accumulator, epsilon, 0, order_sum - i);
+    accumulator += f(i);
+  }
   return accumulator;
 }
 
@@ -1103,8 +1996,34 @@ promote<fvar<RealType, Order>, Fvar, Fvars...> fvar<RealType, Order>::apply_coef
 template <typename RealType, size_t Order>
 template <typename Func>
 fvar<RealType, Order> fvar<RealType, Order>::apply_coefficients_nonhorner(size_t const order,
-                                                                          Func const& f) const {
-  fvar<RealType, Order> const epsilon = fvar<RealType, Order>(*this).set_root(0);
+                                                                          Func const& f) const& {
+  if (is_skipped_constant(*this))
+    return fvar<RealType, Order>(f(0));
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value &&
+                                  !series::has_fast_multiply<RealType, Order, RealType, Order>::value) {
+#ifndef BOOST_NO_CXX17_IF_CONSTEXPR
+    size_t const m = (std::min)(order, order_sum);
+#else  // ODR-use of static constexpr
+    size_t const m = order < order_sum ? order : order_sum;
+#endif
+    fvar<RealType, Order> retval;
+    std::array<RealType, Order + 1> powers;
+    series::compose_powers(retval.v.data(), v.data(), powers.data(), Order + 1, m, f);
+    return retval;
+  }
+  return fvar<RealType, Order>(*this).apply_coefficients_nonhorner(order, f);
+}
+
+template <typename RealType, size_t Order>
+template <typename Func>
+fvar<RealType, Order> fvar<RealType, Order>::apply_coefficients_nonhorner(size_t const order,
+                                                                          Func const& f) && {
+  if (is_skipped_constant(*this))
+    return fvar<RealType, Order>(f(0));
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value &&
+                                  !series::has_fast_multiply<RealType, Order, RealType, Order>::value)
+    return static_cast<fvar<RealType, Order> const&>(*this).apply_coefficients_nonhorner(order, f);
+  fvar<RealType, Order> const& epsilon = set_root(0);
   fvar<RealType, Order> epsilon_i = fvar<RealType, Order>(1);  // epsilon to the power of i
   fvar<RealType, Order> accumulator = fvar<RealType, Order>(f(0u));
 #ifndef BOOST_NO_CXX17_IF_CONSTEXPR
@@ -1112,6 +2031,16 @@ fvar<RealType, Order> fvar<RealType, Order>::apply_coefficients_nonhorner(size_t
 #else  // ODR-use of static constexpr
   size_t const i_max = order < order_sum ? order : order_sum;
 #endif
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_fvar<RealType>::value) {
+    for (size_t i = 1; i <= i_max; ++i) {
+      if (i == 1)
+        epsilon_i = epsilon;
+      else
+        nested::multiply_assign(epsilon_i, epsilon, i - 1, order_sum);
+      nested::add_scaled(accumulator, epsilon_i, f(i));
+    }
+    return accumulator;
+  }
   for (size_t i = 1; i <= i_max; ++i) {
     epsilon_i = epsilon_i.epsilon_multiply(i - 1, 0, epsilon, 1, 0);
     accumulator += epsilon_i.epsilon_multiply(i, 0, f(i));
@@ -1132,13 +2061,13 @@ promote<fvar<RealType, Order>, Fvar, Fvars...> fvar<RealType, Order>::apply_deri
   size_t i = (std::min)(order, order_sum);
   promote<fvar<RealType, Order>, Fvar, Fvars...> accumulator =
       cr.apply_derivatives(
-          order - i, [&f, i](auto... indices) { return f(i, indices...); }, std::forward<Fvars>(fvars)...) /
-      factorial<root_type>(static_cast<unsigned>(i));
+          order - i, [&f, i](auto... indices) { return f(i, indices...); }, std::forward<Fvars>(fvars)...) *
+      inverse_factorial<root_type, order_sum>(static_cast<unsigned>(i));
   while (i--)
     (accumulator *= epsilon) +=
         cr.apply_derivatives(
-            order - i, [&f, i](auto... indices) { return f(i, indices...); }, std::forward<Fvars>(fvars)...) /
-        factorial<root_type>(static_cast<unsigned>(i));
+            order - i, [&f, i](auto... indices) { return f(i, indices...); }, std::forward<Fvars>(fvars)...) *
+        inverse_factorial<root_type, order_sum>(static_cast<unsigned>(i));
   return accumulator;
 }
 #endif
@@ -1146,16 +2075,47 @@ promote<fvar<RealType, Order>, Fvar, Fvars...> fvar<RealType, Order>::apply_deri
 // f : order -> derivative(order)
 template <typename RealType, size_t Order>
 template <typename Func>
-fvar<RealType, Order> fvar<RealType, Order>::apply_derivatives(size_t const order, Func const& f) const {
-  fvar<RealType, Order> const epsilon = fvar<RealType, Order>(*this).set_root(0);
+fvar<RealType, Order> fvar<RealType, Order>::apply_derivatives(size_t const order, Func const& f) const& {
+  if (is_skipped_constant(*this))
+    return fvar<RealType, Order>(f(0));
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar>::value)
+    return chain_rule(*this, f(0), 0 < order ? f(1) : root_type(0), [&f, order] {
+      return 1 < order ? f(2) / 2 : root_type(0);
+    });
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+#ifndef BOOST_NO_CXX17_IF_CONSTEXPR
+    size_t const m = (std::min)(order, order_sum);
+#else  // ODR-use of static constexpr
+    size_t const m = order < order_sum ? order : order_sum;
+#endif
+    fvar<RealType, Order> retval;
+    auto const coefficient = [&f](size_t i) {
+      return f(i) / factorial<root_type, order_sum>(static_cast<unsigned>(i));
+    };
+    series::compose<Order + 1>(retval.v.data(), v.data(), Order + 1, m, coefficient);
+    return retval;
+  }
+  return fvar<RealType, Order>(*this).apply_derivatives(order, f);
+}
+
+template <typename RealType, size_t Order>
+template <typename Func>
+fvar<RealType, Order> fvar<RealType, Order>::apply_derivatives(size_t const order, Func const& f) && {
+  if (is_skipped_constant(*this))
+    return fvar<RealType, Order>(f(0));
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value)
+    return static_cast<fvar<RealType, Order> const&>(*this).apply_derivatives(order, f);
+  fvar<RealType, Order> const& epsilon = set_root(0);
 #ifndef BOOST_NO_CXX17_IF_CONSTEXPR
   size_t i = (std::min)(order, order_sum);
 #else  // ODR-use of static constexpr
   size_t i = order < order_sum ? order : order_sum;
 #endif
-  fvar<RealType, Order> accumulator = f(i) / factorial<root_type>(static_cast<unsigned>(i));
-  while (i--)
-    (accumulator *= epsilon) += f(i) / factorial<root_type>(static_cast<unsigned>(i));
+  fvar<RealType, Order> accumulator = f(i) / factorial<root_type, order_sum>(static_cast<unsigned>(i));
+  while (i--) {
+    nested::multiply_assign(accumulator, epsilon, 0, order_sum - i);
+    accumulator += f(i) / factorial<root_type, order_sum>(static_cast<unsigned>(i));
+  }
   return accumulator;
 }
 
@@ -1183,8 +2143,8 @@ promote<fvar<RealType, Order>, Fvar, Fvars...> fvar<RealType, Order>::apply_deri
         cr.apply_derivatives_nonhorner(
             order - i,
             [&f, i](auto... indices) { return f(i, static_cast<std::size_t>(indices)...); },
-            std::forward<Fvars>(fvars)...) /
-            factorial<root_type>(static_cast<unsigned>(i)),
+            std::forward<Fvars>(fvars)...) *
+            inverse_factorial<root_type, order_sum>(static_cast<unsigned>(i)),
         0,
         0);
   }
@@ -1196,8 +2156,37 @@ promote<fvar<RealType, Order>, Fvar, Fvars...> fvar<RealType, Order>::apply_deri
 template <typename RealType, size_t Order>
 template <typename Func>
 fvar<RealType, Order> fvar<RealType, Order>::apply_derivatives_nonhorner(size_t const order,
-                                                                         Func const& f) const {
-  fvar<RealType, Order> const epsilon = fvar<RealType, Order>(*this).set_root(0);
+                                                                         Func const& f) const& {
+  if (is_skipped_constant(*this))
+    return fvar<RealType, Order>(f(0));
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value &&
+                                  !series::has_fast_multiply<RealType, Order, RealType, Order>::value) {
+#ifndef BOOST_NO_CXX17_IF_CONSTEXPR
+    size_t const m = (std::min)(order, order_sum);
+#else  // ODR-use of static constexpr
+    size_t const m = order < order_sum ? order : order_sum;
+#endif
+    fvar<RealType, Order> retval;
+    std::array<RealType, Order + 1> powers;
+    auto const coefficient = [&f](size_t i) {
+      return f(i) / factorial<root_type, order_sum>(static_cast<unsigned>(i));
+    };
+    series::compose_powers(retval.v.data(), v.data(), powers.data(), Order + 1, m, coefficient);
+    return retval;
+  }
+  return fvar<RealType, Order>(*this).apply_derivatives_nonhorner(order, f);
+}
+
+template <typename RealType, size_t Order>
+template <typename Func>
+fvar<RealType, Order> fvar<RealType, Order>::apply_derivatives_nonhorner(size_t const order,
+                                                                         Func const& f) && {
+  if (is_skipped_constant(*this))
+    return fvar<RealType, Order>(f(0));
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value &&
+                                  !series::has_fast_multiply<RealType, Order, RealType, Order>::value)
+    return static_cast<fvar<RealType, Order> const&>(*this).apply_derivatives_nonhorner(order, f);
+  fvar<RealType, Order> const& epsilon = set_root(0);
   fvar<RealType, Order> epsilon_i = fvar<RealType, Order>(1);  // epsilon to the power of i
   fvar<RealType, Order> accumulator = fvar<RealType, Order>(f(0u));
 #ifndef BOOST_NO_CXX17_IF_CONSTEXPR
@@ -1205,9 +2194,21 @@ fvar<RealType, Order> fvar<RealType, Order>::apply_derivatives_nonhorner(size_t
 #else  // ODR-use of static constexpr
   size_t const i_max = order < order_sum ? order : order_sum;
 #endif
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_fvar<RealType>::value) {
+    for (size_t i = 1; i <= i_max; ++i) {
+      if (i == 1)
+        epsilon_i = epsilon;
+      else
+        nested::multiply_assign(epsilon_i, epsilon, i - 1, order_sum);
+      nested::add_scaled(
+          accumulator, epsilon_i, f(i) / factorial<root_type, order_sum>(static_cast<unsigned>(i)));
+    }
+    return accumulator;
+  }
   for (size_t i = 1; i <= i_max; ++i) {
     epsilon_i = epsilon_i.epsilon_multiply(i - 1, 0, epsilon, 1, 0);
-    accumulator += epsilon_i.epsilon_multiply(i, 0, f(i) / factorial<root_type>(static_cast<unsigned>(i)));
+    accumulator += epsilon_i.epsilon_multiply(
+        i, 0, f(i) / factorial<root_type, order_sum>(static_cast<unsigned>(i)));
   }
   return accumulator;
 }
@@ -1216,7 +2217,9 @@ fvar<RealType, Order> fvar<RealType, Order>::apply_derivatives_nonhorner(size_t
 // Can throw "std::out_of_range: array::at: __n (which is 7) >= _Nm (which is 7)"
 template <typename RealType, size_t Order>
 template <typename... Orders>
-get_type_at<RealType, sizeof...(Orders)> fvar<RealType, Order>::at(size_t order, Orders... orders) const {
+BOOST_AUTODIFF_CONSTEXPR get_type_at<RealType, sizeof...(Orders)> fvar<RealType, Order>::at(
+    size_t order,
+    Orders... orders) const {
   if constexpr (0 < sizeof...(Orders))
     return v.at(order).at(static_cast<std::size_t>(orders)...);
   else
@@ -1228,17 +2231,26 @@ get_type_at<RealType, sizeof...(Orders)> fvar<RealType, Order>::at(size_t order,
 // Can throw "std::out_of_range: array::at: __n (which is 7) >= _Nm (which is 7)"
 template <typename RealType, size_t Order>
 template <typename... Orders>
-get_type_at<fvar<RealType, Order>, sizeof...(Orders)> fvar<RealType, Order>::derivative(
-    Orders... orders) const {
+BOOST_AUTODIFF_CONSTEXPR get_type_at<fvar<RealType, Order>, sizeof...(Orders)>
+fvar<RealType, Order>::derivative(Orders... orders) const {
   static_assert(sizeof...(Orders) <= depth,
                 "Number of parameters to derivative(...) cannot exceed fvar::depth.");
   return at(static_cast<std::size_t>(orders)...) *
-         (... * factorial<root_type>(static_cast<unsigned>(orders)));
+         (... * factorial<root_type, order_sum>(static_cast<unsigned>(orders)));
 }
 #endif
 
 template <typename RealType, size_t Order>
-const RealType& fvar<RealType, Order>::operator[](size_t i) const {
+BOOST_AUTODIFF_CONSTEXPR RealType fvar<RealType, Order>::unscaled_derivative(root_type const& radius,
+                                                                             size_t order) const {
+  RealType retval = v.at(order);
+  for (size_t i = 1; i <= order; ++i)
+    retval *= static_cast<root_type>(i) / radius;
+  return retval;
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR const RealType& fvar<RealType, Order>::operator[](size_t i) const {
   return v[i];
 }
 
@@ -1277,7 +2289,7 @@ fvar<RealType, Order> fvar<RealType, Order>::epsilon_multiply(size_t z0,
       retval.v[j] = epsilon_inner_product(z0, isum0, m0, cr, z1, isum1, m1, j);
   else
     for (size_t i = 0, j = Order; i <= i_max; ++i, --j)
-      retval.v[j] = std::inner_product(
+      retval.v[j] = detail::inner_product(
           v.cbegin() + diff_t(m0), v.cend() - diff_t(i + m1), cr.v.crbegin() + diff_t(i + m0), zero);
   return retval;
 }
@@ -1298,24 +2310,45 @@ fvar<RealType, Order> fvar<RealType, Order>::epsilon_multiply(size_t z0,
       retval.v[i] = retval.v[i].epsilon_multiply(z0, isum0 + i, ca);
   else
     for (size_t i = m0; i <= Order; ++i)
-      if (retval.v[i] != static_cast<RealType>(0))
+      if (fast_math::value)
         retval.v[i] *= ca;
+      else
+        multiply_assign_nonzero(retval.v[i], ca);
   return retval;
 }
 #endif
 
+// cr.inverse(), which branches on whether the root of cr is 0. autodiff_batch.hpp overloads it to evaluate
+// the lanes separately if they take different branches.
+template <typename RealType, size_t Order>
+fvar<RealType, Order> fvar_inverse(fvar<RealType, Order> const& cr) {
+  using root_type = typename fvar<RealType, Order>::root_type;
+  if BOOST_AUTODIFF_IF_CONSTEXPR (series::has_fast_multiply<RealType, Order, RealType, Order>::value) {
+    if (static_cast<root_type>(cr) != 0) {
+      fvar<RealType, Order> retval;
+      series::inverse<Order + 1>(series::has_fast_multiply<RealType, Order, RealType, Order>{},
+                                 fvar_series_access::data(retval),
+                                 fvar_series_access::data(cr));
+      return retval;
+    }
+  }
+  return static_cast<root_type>(cr) == 0 ? cr.inverse_apply() : 1 / cr;
+}
+
 template <typename RealType, size_t Order>
 fvar<RealType, Order> fvar<RealType, Order>::inverse() const {
-  return static_cast<root_type>(*this) == 0 ? inverse_apply() : 1 / *this;
+  return fvar_inverse(*this);
 }
 
 #ifndef BOOST_NO_CXX17_IF_CONSTEXPR
 template <typename RealType, size_t Order>
-fvar<RealType, Order>& fvar<RealType, Order>::negate() {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::negate() {
   if constexpr (is_fvar<RealType>::value)
-    std::for_each(v.begin(), v.end(), [](RealType& r) { r.negate(); });
+    for (RealType& r : v)
+      r.negate();
   else
-    std::for_each(v.begin(), v.end(), [](RealType& a) { a = -a; });
+    for (RealType& a : v)
+      a = -a;
   return *this;
 }
 #endif
@@ -1324,9 +2357,9 @@ fvar<RealType, Order>& fvar<RealType, Order>::negate() {
 // 1 / *this: log(0.0) = depth(1)(-inf,inf,-inf,-nan,-nan,-nan)
 template <typename RealType, size_t Order>
 fvar<RealType, Order> fvar<RealType, Order>::inverse_apply() const {
-  root_type derivatives[order_sum + 1];  // LCOV_EXCL_LINE This causes a false negative on lcov coverage test.
+  std::array<root_type, order_sum + 1> derivatives;
   root_type const x0 = static_cast<root_type>(*this);
-  *derivatives = 1 / x0;
+  derivatives.front() = 1 / x0;
   for (size_t i = 1; i <= order_sum; ++i)
     derivatives[i] = -derivatives[i - 1] * i / x0;
   return apply_derivatives_nonhorner(order_sum, [&derivatives](size_t j) { return derivatives[j]; });
@@ -1334,38 +2367,45 @@ fvar<RealType, Order> fvar<RealType, Order>::inverse_apply() const {
 
 #ifndef BOOST_NO_CXX17_IF_CONSTEXPR
 template <typename RealType, size_t Order>
-fvar<RealType, Order>& fvar<RealType, Order>::multiply_assign_by_root_type(bool is_root,
-                                                                           root_type const& ca) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::multiply_assign_by_root_type(
+    bool is_root,
+    root_type const& ca) {
   auto itr = v.begin();
   if constexpr (is_fvar<RealType>::value) {
     itr->multiply_assign_by_root_type(is_root, ca);
     for (++itr; itr != v.end(); ++itr)
       itr->multiply_assign_by_root_type(false, ca);
+  } else if constexpr (fast_math::value) {
+    RealType const c = ca;  // Not a reference, which could alias v and be reloaded at each step.
+    for (RealType& a : v)
+      a *= c;
   } else {
-    if (is_root || *itr != 0)
-      *itr *= ca;  // Skip multiplication of 0 by ca=inf to avoid nan, except when is_root.
+    // Skip multiplication of 0 by ca=inf to avoid nan, except when is_root.
+    if (is_root)
+      *itr *= ca;
+    else
+      multiply_assign_nonzero(*itr, ca);
     for (++itr; itr != v.end(); ++itr)
-      if (*itr != 0)
-        *itr *= ca;
+      multiply_assign_nonzero(*itr, ca);
   }
   return *this;
 }
 #endif
 
 template <typename RealType, size_t Order>
-fvar<RealType, Order>::operator root_type() const {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>::operator root_type() const {
   return static_cast<root_type>(v.front());
 }
 
 template <typename RealType, size_t Order>
 template <typename T, typename>
-fvar<RealType, Order>::operator T() const {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>::operator T() const {
   return static_cast<T>(static_cast<root_type>(v.front()));
 }
 
 #ifndef BOOST_NO_CXX17_IF_CONSTEXPR
 template <typename RealType, size_t Order>
-fvar<RealType, Order>& fvar<RealType, Order>::set_root(root_type const& root) {
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order>& fvar<RealType, Order>::set_root(root_type const& root) {
   if constexpr (is_fvar<RealType>::value)
     v.front().set_root(root);
   else
@@ -1379,9 +2419,11 @@ fvar<RealType, Order>& fvar<RealType, Order>::set_root(root_type const& root) {
 template <typename RealType, size_t Order>
 fvar<RealType, Order> fabs(fvar<RealType, Order> const& cr) {
   typename fvar<RealType, Order>::root_type const zero(0);
-  return cr < zero ? -cr
-                   : cr == zero ? fvar<RealType, Order>()  // Canonical fabs'(0) = 0.
-                                : cr;                      // Propagate NaN.
+  if (cr < zero)
+    return -cr;
+  if (cr == zero)
+    return fvar<RealType, Order>();  // Canonical fabs'(0) = 0.
+  return cr;                         // Propagate NaN.
 }
 
 template <typename RealType, size_t Order>
@@ -1406,7 +2448,24 @@ fvar<RealType, Order> exp(fvar<RealType, Order> const& cr) {
   using std::exp;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
   using root_type = typename fvar<RealType, Order>::root_type;
+  if BOOST_AUTODIFF_IF_CONSTEXPR (series::has_fast_multiply<RealType, Order, RealType, Order>::value) {
+    fvar<RealType, Order> retval;
+    series::exp<Order + 1>(series::has_fast_multiply<RealType, Order, RealType, Order>{},
+                           fvar_series_access::data(retval),
+                           fvar_series_access::data(cr));
+    return retval;
+  }
   root_type const d0 = exp(static_cast<root_type>(cr));
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value)
+    return chain_rule(cr, d0, d0, [&d0] { return d0 / 2; });
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    fvar<RealType, Order> retval(d0);
+    if (is_skipped_constant(cr))
+      return retval;
+    series::exp_recurrence(
+        fvar_series_access::data(retval), fvar_series_access::data(cr), Order + 1, static_cast<RealType>(1));
+    return retval;
+  }
   return cr.apply_derivatives(order, [&d0](size_t) { return d0; });
 }
 
@@ -1417,6 +2476,21 @@ fvar<RealType, Order> pow(fvar<RealType, Order> const& x,
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
   root_type const x0 = static_cast<root_type>(x);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    if (0 < x0 || x0 < 0) {
+      fvar<RealType, Order> retval(pow(x0, y));
+      if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+        root_type const d0 = static_cast<root_type>(retval);
+        root_type const d1 = y * d0 / x0;
+        return chain_rule(x, d0, d1, [&] { return (y - 1) * d1 / (2 * x0); });
+      }
+      if (is_skipped_constant(x))
+        return retval;
+      series::pow_recurrence(
+          fvar_series_access::data(retval), fvar_series_access::data(x), Order + 1, static_cast<RealType>(y));
+      return retval;
+    }
+  }
   root_type derivatives[order + 1]{pow(x0, y)};
   for (size_t i = 0; i < order && y - i != 0; ++i)
     derivatives[i + 1] = (y - i) * derivatives[i] / x0;
@@ -1433,6 +2507,20 @@ fvar<RealType, Order> pow(typename fvar<RealType, Order>::root_type const& x,
   root_type derivatives[order + 1];
   *derivatives = pow(x, y0);
   root_type const logx = log(x);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    if (0 < x) {  // x^y = exp(log(x)*y)
+      if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value)
+        return chain_rule(y, *derivatives, *derivatives * logx, [&] {
+          return *derivatives * logx * logx / 2;
+        });
+      fvar<RealType, Order> retval(*derivatives);
+      if (is_skipped_constant(y))
+        return retval;
+      series::exp_recurrence(
+          fvar_series_access::data(retval), fvar_series_access::data(y), Order + 1, static_cast<RealType>(logx));
+      return retval;
+    }
+  }
   for (size_t i = 0; i < order; ++i)
     derivatives[i + 1] = derivatives[i] * logx;
   return y.apply_derivatives(order, [&derivatives](size_t i) { return derivatives[i]; });
@@ -1463,15 +2551,12 @@ promote<fvar<RealType1, Order1>, fvar<RealType2, Order2>> pow(fvar<RealType1, Or
     for (size_t i = 1; i < order; ++i)
       lognx[i + 1] = lognx[i] * lognx[1];
     auto const f = [&dxydx, &lognx](size_t i, size_t j) {
-      size_t binomial = 1;
       root_type sum = dxydx[i] * static_cast<root_type>(lognx[j]);
-      for (size_t k = 1; k <= i; ++k) {
-        (binomial *= (i - k + 1)) /= k;  // binomial_coefficient(i,k)
-        sum += binomial * dxydx[i - k] * lognx[j].derivative(k);
-      }
+      for (size_t k = 1; k <= i; ++k)
+        sum += binomial<root_type, order>(i, k) * dxydx[i - k] * lognx[j].derivative(k);
       return sum;
     };
-    if (fabs(x0) < std::numeric_limits<root_type>::epsilon())
+    if (!fast_math::value && fabs(x0) < std::numeric_limits<root_type>::epsilon())
       return x.apply_derivatives_nonhorner(order, f, y);
     return x.apply_derivatives(order, f, y);
   }
@@ -1482,6 +2567,32 @@ fvar<RealType, Order> sqrt(fvar<RealType, Order> const& cr) {
   using std::sqrt;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
+  if BOOST_AUTODIFF_IF_CONSTEXPR (series::has_fast_multiply<RealType, Order, RealType, Order>::value) {
+    if (0 < cr) {
+      fvar<RealType, Order> retval;
+      series::sqrt<Order + 1>(series::has_fast_multiply<RealType, Order, RealType, Order>{},
+                              fvar_series_access::data(retval),
+                              fvar_series_access::data(cr));
+      return retval;
+    }
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    if (0 < cr) {  // sqrt(x) = x^(1/2)
+      fvar<RealType, Order> retval(sqrt(static_cast<root_type>(cr)));
+      if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+        root_type const x0 = static_cast<root_type>(cr);
+        root_type const d1 = 0.5 / static_cast<root_type>(retval);
+        return chain_rule(cr, static_cast<root_type>(retval), d1, [&] { return -d1 / (4 * x0); });
+      }
+      if (is_skipped_constant(cr))
+        return retval;
+      series::pow_recurrence(fvar_series_access::data(retval),
+                             fvar_series_access::data(cr),
+                             Order + 1,
+                             static_cast<RealType>(0.5));
+      return retval;
+    }
+  }
   root_type derivatives[order + 1];
   root_type const x = static_cast<root_type>(cr);
   *derivatives = sqrt(x);
@@ -1502,7 +2613,7 @@ fvar<RealType, Order> sqrt(fvar<RealType, Order> const& cr) {
       derivatives[i] = numerator / (powers * *derivatives);
     }
     auto const f = [&derivatives](size_t i) { return derivatives[i]; };
-    if (cr < std::numeric_limits<root_type>::epsilon())
+    if (!fast_math::value && cr < std::numeric_limits<root_type>::epsilon())
       return cr.apply_derivatives_nonhorner(order, f);
     return cr.apply_derivatives(order, f);
   }
@@ -1514,12 +2625,35 @@ fvar<RealType, Order> log(fvar<RealType, Order> const& cr) {
   using std::log;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
+  if BOOST_AUTODIFF_IF_CONSTEXPR (series::has_fast_multiply<RealType, Order, RealType, Order>::value) {
+    if (0 < cr) {
+      fvar<RealType, Order> retval;
+      series::log<Order + 1>(series::has_fast_multiply<RealType, Order, RealType, Order>{},
+                             fvar_series_access::data(retval),
+                             fvar_series_access::data(cr));
+      return retval;
+    }
+  }
   root_type const d0 = log(static_cast<root_type>(cr));
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    if (0 < cr) {
+      if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+        root_type const d1 = 1 / static_cast<root_type>(cr);
+        return chain_rule(cr, d0, d1, [&d1] { return -d1 * d1 / 2; });
+      }
+      fvar<RealType, Order> retval(d0);
+      if (is_skipped_constant(cr))
+        return retval;
+      series::log_recurrence(fvar_series_access::data(retval), fvar_series_access::data(cr), Order + 1);
+      return retval;
+    }
+  }
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
     auto const d1 = make_fvar<root_type, order - 1>(static_cast<root_type>(cr)).inverse();  // log'(x) = 1 / x
-    return cr.apply_coefficients_nonhorner(order, [&d0, &d1](size_t i) { return i ? d1[i - 1] / i : d0; });
+    return cr.apply_coefficients_nonhorner(
+        order, [&d0, &d1](size_t i) { return i ? d1[i - 1] / i : d0; });
   }
 }
 
@@ -1541,11 +2675,37 @@ fvar<RealType, Order> ldexp(fvar<RealType, Order> const& cr, int exp) {
   return cr * exp2(static_cast<typename fvar<RealType, Order>::root_type>(exp));
 }
 
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fma(fvar<RealType, Order> const& cr1,
+                                                   fvar<RealType, Order> const& cr2,
+                                                   fvar<RealType, Order> cr3) {
+  cr3.add_product(cr1, cr2);
+  return cr3;
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fma(fvar<RealType, Order> const& cr1,
+                                                   typename fvar<RealType, Order>::root_type const& ca,
+                                                   fvar<RealType, Order> cr3) {
+  cr3.add_product(ca, cr1);
+  return cr3;
+}
+
+template <typename RealType, size_t Order>
+BOOST_AUTODIFF_CONSTEXPR fvar<RealType, Order> fma(typename fvar<RealType, Order>::root_type const& ca,
+                                                   fvar<RealType, Order> const& cr2,
+                                                   fvar<RealType, Order> cr3) {
+  cr3.add_product(ca, cr2);
+  return cr3;
+}
+
 template <typename RealType, size_t Order>
 fvar<RealType, Order> cos(fvar<RealType, Order> const& cr) {
   BOOST_MATH_STD_USING
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value)
+    return sincos(cr).second;
   root_type const d0 = cos(static_cast<root_type>(cr));
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
@@ -1561,6 +2721,8 @@ fvar<RealType, Order> sin(fvar<RealType, Order> const& cr) {
   BOOST_MATH_STD_USING
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value)
+    return sincos(cr).first;
   root_type const d0 = sin(static_cast<root_type>(cr));
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
@@ -1571,18 +2733,107 @@ fvar<RealType, Order> sin(fvar<RealType, Order> const& cr) {
   }
 }
 
+template <typename RealType, size_t Order>
+std::pair<fvar<RealType, Order>, fvar<RealType, Order>> sincos(fvar<RealType, Order> const& cr) {
+  BOOST_MATH_STD_USING
+  using root_type = typename fvar<RealType, Order>::root_type;
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_fvar<RealType>::value)
+    return std::make_pair(sin(cr), cos(cr));
+  root_type const x = static_cast<root_type>(cr);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+    root_type const s = sin(x);
+    root_type const c = cos(x);
+    return std::make_pair(chain_rule(cr, s, c, [&s] { return -s / 2; }),
+                          chain_rule(cr, c, -s, [&c] { return -c / 2; }));
+  }
+  std::pair<fvar<RealType, Order>, fvar<RealType, Order>> retval(fvar<RealType, Order>(sin(x)),
+                                                                 fvar<RealType, Order>(cos(x)));
+  if (is_skipped_constant(cr))
+    return retval;
+  series::sincos_recurrence(fvar_series_access::data(retval.first),
+                            fvar_series_access::data(retval.second),
+                            fvar_series_access::data(cr),
+                            Order + 1,
+                            static_cast<RealType>(-1));
+  return retval;
+}
+
+// y(a) with root y0 and y' = c*a'/q(a), for q(x) = alpha + beta*x*x or its square root, as for the inverse
+// trigonometric and hyperbolic functions. q(a) and y(a) follow from the recurrences of detail/autodiff_series.hpp.
+// The root of q(a) must not be 0.
+template <typename RealType, size_t Order>
+fvar<RealType, Order> integrate_quadratic(fvar<RealType, Order> const& cr,
+                                          typename fvar<RealType, Order>::root_type const& y0,
+                                          typename fvar<RealType, Order>::root_type const& alpha,
+                                          typename fvar<RealType, Order>::root_type const& beta,
+                                          bool const is_sqrt,
+                                          typename fvar<RealType, Order>::root_type const& c) {
+  using std::sqrt;
+  if (is_skipped_constant(cr))
+    return fvar<RealType, Order>(y0);
+  RealType const* const a = fvar_series_access::data(cr);
+  std::array<RealType, Order + 1> q;
+  series::square(q.data(), a, Order + 1);
+  for (RealType& qk : q)
+    qk *= static_cast<RealType>(beta);
+  q.front() += static_cast<RealType>(alpha);
+  if (is_sqrt) {
+    std::array<RealType, Order + 1> const w(q);
+    q.front() = sqrt(w.front());
+    series::pow_recurrence(q.data(), w.data(), Order + 1, static_cast<RealType>(0.5));
+  }
+  fvar<RealType, Order> retval(y0);
+  series::integrate_quotient(
+      fvar_series_access::data(retval), a, q.data(), Order + 1, static_cast<RealType>(c));
+  return retval;
+}
+
+// y(a) with root y0 and y' = c*a'*exp(-a*a), as for erf and erfc.
+template <typename RealType, size_t Order>
+fvar<RealType, Order> integrate_gaussian(fvar<RealType, Order> const& cr,
+                                         typename fvar<RealType, Order>::root_type const& y0,
+                                         typename fvar<RealType, Order>::root_type const& c) {
+  using std::exp;
+  if (is_skipped_constant(cr))
+    return fvar<RealType, Order>(y0);
+  RealType const* const a = fvar_series_access::data(cr);
+  std::array<RealType, Order + 1> w;
+  series::square(w.data(), a, Order + 1);
+  for (RealType& wk : w)
+    wk = -wk;
+  std::array<RealType, Order + 1> q;
+  q.front() = exp(w.front());
+  series::exp_recurrence(q.data(), w.data(), Order + 1, static_cast<RealType>(1));
+  fvar<RealType, Order> retval(y0);
+  series::integrate_product(
+      fvar_series_access::data(retval), a, q.data(), Order + 1, static_cast<RealType>(c));
+  return retval;
+}
+
 template <typename RealType, size_t Order>
 fvar<RealType, Order> asin(fvar<RealType, Order> const& cr) {
   using std::asin;
+  using std::sqrt;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
-  root_type const d0 = asin(static_cast<root_type>(cr));
+  root_type const x0 = static_cast<root_type>(cr);
+  root_type const d0 = asin(x0);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    if (-1 < x0 && x0 < 1) {  // asin'(x) = 1 / sqrt(1-x*x).
+      if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+        root_type const d1 = 1 / sqrt(1 - x0 * x0);  // asin''(x) = x*asin'(x)^3
+        return chain_rule(cr, d0, d1, [&] { return x0 * d1 * d1 * d1 / 2; });
+      }
+      return integrate_quadratic(cr, d0, 1, -1, true, 1);
+    }
+  }
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
     auto x = make_fvar<root_type, order - 1>(static_cast<root_type>(cr));
     auto const d1 = sqrt((x *= x).negate() += 1).inverse();  // asin'(x) = 1 / sqrt(1-x*x).
-    return cr.apply_coefficients_nonhorner(order, [&d0, &d1](size_t i) { return i ? d1[i - 1] / i : d0; });
+    return cr.apply_coefficients_nonhorner(
+        order, [&d0, &d1](size_t i) { return i ? d1[i - 1] / i : d0; });
   }
 }
 
@@ -1592,12 +2843,29 @@ fvar<RealType, Order> tan(fvar<RealType, Order> const& cr) {
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
   root_type const d0 = tan(static_cast<root_type>(cr));
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value)
+    return chain_rule(cr, d0, 1 + d0 * d0, [&d0] {  // tan'(x) = 1 + tan(x)^2
+      return d0 * (1 + d0 * d0);
+    });
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    fvar<RealType, Order> retval(d0);
+    if (is_skipped_constant(cr))
+      return retval;
+    std::array<RealType, Order + 1> w;  // tan'(x) = 1 + tan(x)^2
+    series::tan_recurrence(fvar_series_access::data(retval),
+                           fvar_series_access::data(cr),
+                           w.data(),
+                           Order + 1,
+                           static_cast<RealType>(1));
+    return retval;
+  }
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
     auto c = cos(make_fvar<root_type, order - 1>(static_cast<root_type>(cr)));
     auto const d1 = (c *= c).inverse();  // tan'(x) = 1 / cos(x)^2
-    return cr.apply_coefficients_nonhorner(order, [&d0, &d1](size_t i) { return i ? d1[i - 1] / i : d0; });
+    return cr.apply_coefficients_nonhorner(
+        order, [&d0, &d1](size_t i) { return i ? d1[i - 1] / i : d0; });
   }
 }
 
@@ -1606,7 +2874,14 @@ fvar<RealType, Order> atan(fvar<RealType, Order> const& cr) {
   using std::atan;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
-  root_type const d0 = atan(static_cast<root_type>(cr));
+  root_type const x0 = static_cast<root_type>(cr);
+  root_type const d0 = atan(x0);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+    root_type const d1 = 1 / (x0 * x0 + 1);
+    return chain_rule(cr, d0, d1, [&] { return -x0 * d1 * d1; });
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value)
+    return integrate_quadratic(cr, d0, 1, 1, false, 1);  // atan'(x) = 1 / (x*x+1).
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
@@ -1622,7 +2897,17 @@ fvar<RealType, Order> atan2(fvar<RealType, Order> const& cr,
   using std::atan2;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
-  root_type const d0 = atan2(static_cast<root_type>(cr), ca);
+  root_type const y0 = static_cast<root_type>(cr);
+  root_type const d0 = atan2(y0, ca);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    if (0 < y0 * y0 + ca * ca) {  // (d/dy)atan2(y,x) = x / (y*y+x*x)
+      if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+        root_type const q = 1 / (y0 * y0 + ca * ca);
+        return chain_rule(cr, d0, ca * q, [&] { return -y0 * ca * q * q; });
+      }
+      return integrate_quadratic(cr, d0, ca * ca, 1, false, ca);
+    }
+  }
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
@@ -1638,7 +2923,17 @@ fvar<RealType, Order> atan2(typename fvar<RealType, Order>::root_type const& ca,
   using std::atan2;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
-  root_type const d0 = atan2(ca, static_cast<root_type>(cr));
+  root_type const x0 = static_cast<root_type>(cr);
+  root_type const d0 = atan2(ca, x0);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    if (0 < x0 * x0 + ca * ca) {  // (d/dx)atan2(y,x) = -y / (x*x+y*y)
+      if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+        root_type const q = 1 / (x0 * x0 + ca * ca);
+        return chain_rule(cr, d0, -ca * q, [&] { return x0 * ca * q * q; });
+      }
+      return integrate_quadratic(cr, d0, ca * ca, 1, false, -ca);
+    }
+  }
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
@@ -1652,12 +2947,20 @@ template <typename RealType1, size_t Order1, typename RealType2, size_t Order2>
 promote<fvar<RealType1, Order1>, fvar<RealType2, Order2>> atan2(fvar<RealType1, Order1> const& cr1,
                                                                 fvar<RealType2, Order2> const& cr2) {
   using std::atan2;
+  using std::fabs;
   using return_type = promote<fvar<RealType1, Order1>, fvar<RealType2, Order2>>;
   using root_type = typename return_type::root_type;
   constexpr size_t order = return_type::order_sum;
   root_type const y = static_cast<root_type>(cr1);
   root_type const x = static_cast<root_type>(cr2);
   root_type const d00 = atan2(y, x);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (get_depth<return_type>::value == 1) {
+    // atan2(y,x) differs from atan(y/x) and from -atan(x/y) by constants. Divide by the larger root.
+    if (fabs(y) <= fabs(x) && 0 < fabs(x))
+      return integrate_quadratic(return_type(cr1) / return_type(cr2), d00, 1, 1, false, 1);
+    if (fabs(x) <= fabs(y) && 0 < fabs(y))
+      return integrate_quadratic(return_type(cr2) / return_type(cr1), d00, 1, 1, false, -1);
+  }
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return return_type(d00);
   else {
@@ -1745,9 +3048,20 @@ std::ostream& operator<<(std::ostream& out, fvar<RealType, Order> const& cr) {
 template <typename RealType, size_t Order>
 fvar<RealType, Order> acos(fvar<RealType, Order> const& cr) {
   using std::acos;
+  using std::sqrt;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
-  root_type const d0 = acos(static_cast<root_type>(cr));
+  root_type const x0 = static_cast<root_type>(cr);
+  root_type const d0 = acos(x0);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    if (-1 < x0 && x0 < 1) {  // acos'(x) = -1 / sqrt(1-x*x).
+      if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+        root_type const d1 = -1 / sqrt(1 - x0 * x0);  // acos''(x) = x*acos'(x)^3
+        return chain_rule(cr, d0, d1, [&] { return x0 * d1 * d1 * d1 / 2; });
+      }
+      return integrate_quadratic(cr, d0, 1, -1, true, -1);
+    }
+  }
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
@@ -1760,9 +3074,20 @@ fvar<RealType, Order> acos(fvar<RealType, Order> const& cr) {
 template <typename RealType, size_t Order>
 fvar<RealType, Order> acosh(fvar<RealType, Order> const& cr) {
   using boost::math::acosh;
+  using std::sqrt;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
-  root_type const d0 = acosh(static_cast<root_type>(cr));
+  root_type const x0 = static_cast<root_type>(cr);
+  root_type const d0 = acosh(x0);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    if (1 < x0) {  // acosh'(x) = 1 / sqrt(x*x-1).
+      if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+        root_type const d1 = 1 / sqrt(x0 * x0 - 1);  // acosh''(x) = -x*acosh'(x)^3
+        return chain_rule(cr, d0, d1, [&] { return -x0 * d1 * d1 * d1 / 2; });
+      }
+      return integrate_quadratic(cr, d0, -1, 1, true, 1);
+    }
+  }
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
@@ -1775,9 +3100,17 @@ fvar<RealType, Order> acosh(fvar<RealType, Order> const& cr) {
 template <typename RealType, size_t Order>
 fvar<RealType, Order> asinh(fvar<RealType, Order> const& cr) {
   using boost::math::asinh;
+  using std::sqrt;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
-  root_type const d0 = asinh(static_cast<root_type>(cr));
+  root_type const x0 = static_cast<root_type>(cr);
+  root_type const d0 = asinh(x0);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+    root_type const d1 = 1 / sqrt(x0 * x0 + 1);  // asinh''(x) = -x*asinh'(x)^3
+    return chain_rule(cr, d0, d1, [&] { return -x0 * d1 * d1 * d1 / 2; });
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value)
+    return integrate_quadratic(cr, d0, 1, 1, true, 1);  // asinh'(x) = 1 / sqrt(x*x+1).
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
@@ -1792,7 +3125,17 @@ fvar<RealType, Order> atanh(fvar<RealType, Order> const& cr) {
   using boost::math::atanh;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
-  root_type const d0 = atanh(static_cast<root_type>(cr));
+  root_type const x0 = static_cast<root_type>(cr);
+  root_type const d0 = atanh(x0);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    if (-1 < x0 && x0 < 1) {  // atanh'(x) = 1 / (1-x*x)
+      if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+        root_type const d1 = 1 / (1 - x0 * x0);
+        return chain_rule(cr, d0, d1, [&] { return x0 * d1 * d1; });
+      }
+      return integrate_quadratic(cr, d0, 1, -1, false, 1);
+    }
+  }
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
@@ -1807,6 +3150,8 @@ fvar<RealType, Order> cosh(fvar<RealType, Order> const& cr) {
   BOOST_MATH_STD_USING
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value)
+    return sinhcosh(cr).second;
   root_type const d0 = cosh(static_cast<root_type>(cr));
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
@@ -1828,17 +3173,26 @@ fvar<RealType, Order> digamma(fvar<RealType, Order> const& cr) {
   else {
     static_assert(order <= static_cast<size_t>(std::numeric_limits<int>::max()),
                   "order exceeds maximum derivative for boost::math::polygamma().");
+    using boost::math::polygamma;
     return cr.apply_derivatives(
-        order, [&x, &d0](size_t i) { return i ? boost::math::polygamma(static_cast<int>(i), x) : d0; });
+        order, [&x, &d0](size_t i) { return i ? polygamma(static_cast<int>(i), x) : d0; });
   }
 }
 
 template <typename RealType, size_t Order>
 fvar<RealType, Order> erf(fvar<RealType, Order> const& cr) {
   using boost::math::erf;
+  using std::exp;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
-  root_type const d0 = erf(static_cast<root_type>(cr));
+  root_type const x0 = static_cast<root_type>(cr);
+  root_type const d0 = erf(x0);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+    root_type const d1 = 2 * constants::one_div_root_pi<root_type>() * exp(-x0 * x0);
+    return chain_rule(cr, d0, d1, [&] { return -x0 * d1; });
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value)  // erf'(x) = 2/sqrt(pi)*exp(-x*x)
+    return integrate_gaussian(cr, d0, 2 * constants::one_div_root_pi<root_type>());
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
@@ -1851,9 +3205,17 @@ fvar<RealType, Order> erf(fvar<RealType, Order> const& cr) {
 template <typename RealType, size_t Order>
 fvar<RealType, Order> erfc(fvar<RealType, Order> const& cr) {
   using boost::math::erfc;
+  using std::exp;
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
-  root_type const d0 = erfc(static_cast<root_type>(cr));
+  root_type const x0 = static_cast<root_type>(cr);
+  root_type const d0 = erfc(x0);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+    root_type const d1 = -2 * constants::one_div_root_pi<root_type>() * exp(-x0 * x0);
+    return chain_rule(cr, d0, d1, [&] { return -x0 * d1; });
+  }
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value)  // erfc'(x) = -erf'(x)
+    return integrate_gaussian(cr, d0, -2 * constants::one_div_root_pi<root_type>());
   if BOOST_AUTODIFF_IF_CONSTEXPR (order == 0)
     return fvar<RealType, Order>(d0);
   else {
@@ -1877,7 +3239,8 @@ fvar<RealType, Order> lambert_w0(fvar<RealType, Order> const& cr) {
     root_type const expw = exp(*derivatives);
     derivatives[1] = 1 / (static_cast<root_type>(cr) + expw);
     if BOOST_AUTODIFF_IF_CONSTEXPR (order == 1)
-      return cr.apply_derivatives_nonhorner(order, [&derivatives](size_t i) { return derivatives[i]; });
+      return cr.apply_derivatives_nonhorner(
+          order, [&derivatives](size_t i) { return derivatives[i]; });
     else {
       using diff_t = typename std::array<RealType, Order + 1>::difference_type;
       root_type d1powers = derivatives[1] * derivatives[1];
@@ -1896,7 +3259,8 @@ fvar<RealType, Order> lambert_w0(fvar<RealType, Order> const& cr) {
                                        coef[n - 1],
                                        [&x](root_type const& a, root_type const& b) { return a * x + b; });
       }
-      return cr.apply_derivatives_nonhorner(order, [&derivatives](size_t i) { return derivatives[i]; });
+      return cr.apply_derivatives_nonhorner(
+          order, [&derivatives](size_t i) { return derivatives[i]; });
     }
   }
 }
@@ -1913,8 +3277,9 @@ fvar<RealType, Order> lgamma(fvar<RealType, Order> const& cr) {
   else {
     static_assert(order <= static_cast<size_t>(std::numeric_limits<int>::max()) + 1,
                   "order exceeds maximum derivative for boost::math::polygamma().");
+    using boost::math::polygamma;
     return cr.apply_derivatives(
-        order, [&x, &d0](size_t i) { return i ? boost::math::polygamma(static_cast<int>(i - 1), x) : d0; });
+        order, [&x, &d0](size_t i) { return i ? polygamma(static_cast<int>(i - 1), x) : d0; });
   }
 }
 
@@ -1929,7 +3294,8 @@ fvar<RealType, Order> sinc(fvar<RealType, Order> const& cr) {
     return fvar<RealType, Order>(*taylor);
   else {
     for (size_t n = 2; n <= order; n += 2)
-      taylor[n] = (1 - static_cast<int>(n & 2)) / factorial<root_type>(static_cast<unsigned>(n + 1));
+      taylor[n] = (1 - static_cast<int>(n & 2)) *
+                  inverse_factorial<root_type, order + 1>(static_cast<unsigned>(n + 1));
     return cr.apply_coefficients_nonhorner(order, [&taylor](size_t i) { return taylor[i]; });
   }
 }
@@ -1939,6 +3305,8 @@ fvar<RealType, Order> sinh(fvar<RealType, Order> const& cr) {
   BOOST_MATH_STD_USING
   using root_type = typename fvar<RealType, Order>::root_type;
   constexpr size_t order = fvar<RealType, Order>::order_sum;
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value)
+    return sinhcosh(cr).first;
   root_type const d0 = sinh(static_cast<root_type>(cr));
   if BOOST_AUTODIFF_IF_CONSTEXPR (fvar<RealType, Order>::order_sum == 0)
     return fvar<RealType, Order>(d0);
@@ -1948,8 +3316,51 @@ fvar<RealType, Order> sinh(fvar<RealType, Order> const& cr) {
   }
 }
 
+template <typename RealType, size_t Order>
+std::pair<fvar<RealType, Order>, fvar<RealType, Order>> sinhcosh(fvar<RealType, Order> const& cr) {
+  BOOST_MATH_STD_USING
+  using root_type = typename fvar<RealType, Order>::root_type;
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_fvar<RealType>::value)
+    return std::make_pair(sinh(cr), cosh(cr));
+  root_type const x = static_cast<root_type>(cr);
+  if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+    root_type const s = sinh(x);
+    root_type const c = cosh(x);
+    return std::make_pair(chain_rule(cr, s, c, [&s] { return s / 2; }),
+                          chain_rule(cr, c, s, [&c] { return c / 2; }));
+  }
+  std::pair<fvar<RealType, Order>, fvar<RealType, Order>> retval(fvar<RealType, Order>(sinh(x)),
+                                                                 fvar<RealType, Order>(cosh(x)));
+  if (is_skipped_constant(cr))
+    return retval;
+  series::sincos_recurrence(fvar_series_access::data(retval.first),
+                            fvar_series_access::data(retval.second),
+                            fvar_series_access::data(cr),
+                            Order + 1,
+                            static_cast<RealType>(1));
+  return retval;
+}
+
 template <typename RealType, size_t Order>
 fvar<RealType, Order> tanh(fvar<RealType, Order> const& cr) {
+  if BOOST_AUTODIFF_IF_CONSTEXPR (!is_fvar<RealType>::value) {
+    BOOST_MATH_STD_USING
+    using root_type = typename fvar<RealType, Order>::root_type;
+    fvar<RealType, Order> retval(tanh(static_cast<root_type>(cr)));
+    if BOOST_AUTODIFF_IF_CONSTEXPR (is_closed_form<fvar<RealType, Order>>::value) {
+      root_type const d0 = static_cast<root_type>(retval);
+      return chain_rule(cr, d0, 1 - d0 * d0, [&d0] { return -d0 * (1 - d0 * d0); });
+    }
+    if (is_skipped_constant(cr))
+      return retval;
+    std::array<RealType, Order + 1> w;  // tanh'(x) = 1 - tanh(x)^2
+    series::tan_recurrence(fvar_series_access::data(retval),
+                           fvar_series_access::data(cr),
+                           w.data(),
+                           Order + 1,
+                           static_cast<RealType>(-1));
+    return retval;
+  }
   fvar<RealType, Order> retval = exp(cr * 2);
   fvar<RealType, Order> const denom = retval + 1;
   (retval -= 1) /= denom;
@@ -2050,6 +3461,10 @@ struct evaluation<fvar_t<double, Order>, Policy> {
 };
 
 }  // namespace policies
+
+// Generic Boost.Math code that calls boost::math::fma() rather than relying on argument-dependent lookup.
+using differentiation::detail::fma;
+
 }  // namespace math
 }  // namespace boost
 
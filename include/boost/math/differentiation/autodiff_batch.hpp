@@ -0,0 +1,567 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+// Notes:
+//  * batch<RealType,Lanes> is a root_type for fvar that holds Lanes independent values of RealType in a
+//    structure-of-arrays layout. fvar<batch<double,8>,Order> evaluates the same function at 8 points per
+//    operation, with each coefficient of the fvar held as one contiguous pack of 8 doubles. All arithmetic is
+//    written as fixed-length loops over the lanes, which compilers vectorize.
+//  * make_fvar(), make_ftuple(), derivative() and the fvar functions work as usual, except for frexp() and
+//    iround(), whose single int cannot hold a value for each lane. Use batch::operator[] on the return value
+//    of derivative() to extract the value of an individual lane.
+//  * Comparison operators are true only if they are true for every lane, except for != which is true if it
+//    is true for any lane. fvar functions that branch on the value of their argument (e.g. fabs, or sqrt and
+//    log for the root value 0) are evaluated lane by lane when the lanes would take different branches.
+
+#ifndef BOOST_MATH_DIFFERENTIATION_AUTODIFF_BATCH_HPP
+#define BOOST_MATH_DIFFERENTIATION_AUTODIFF_BATCH_HPP
+
+#include <boost/math/differentiation/autodiff.hpp>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace boost {
+namespace math {
+namespace differentiation {
+inline namespace autodiff_v1 {
+namespace detail {
+
+// Alignment of the lanes of a batch: their size in bytes rounded up to a power of 2, at most 64.
+constexpr size_t batch_alignment(size_t bytes, size_t alignment = 1) {
+  return bytes <= alignment || 64 <= alignment ? alignment : batch_alignment(bytes, 2 * alignment);
+}
+
+template <typename RealType, size_t Lanes>
+class batch {
+  static_assert(std::is_floating_point<RealType>::value, "batch lane type must be a floating point type.");
+  static_assert(0 < Lanes, "batch must have at least one lane.");
+
+#ifndef BOOST_NO_CXX11_ALIGNAS
+  alignas(batch_alignment(sizeof(RealType) * Lanes))
+#endif
+      std::array<RealType, Lanes> v;
+
+ public:
+  using value_type = RealType;
+
+  static constexpr size_t lanes = Lanes;
+
+  batch() = default;
+
+  // Broadcast ca to all lanes. Implicit, so that batch can be used wherever RealType is expected.
+  batch(RealType const& ca);
+
+  template <typename RealType2,
+            typename = typename std::enable_if<std::is_arithmetic<RealType2>::value &&
+                                               !std::is_same<RealType2, RealType>::value>::type>
+  batch(RealType2 const& ca);
+
+  // Initialize each lane independently.
+  explicit batch(std::array<RealType, Lanes> const& ca);
+
+  RealType& operator[](size_t lane);
+
+  RealType const& operator[](size_t lane) const;
+
+  batch& operator+=(batch const&);
+
+  batch& operator-=(batch const&);
+
+  batch& operator*=(batch const&);
+
+  batch& operator/=(batch const&);
+
+  batch operator-() const;
+
+  batch const& operator+() const;
+
+  // Apply f to each lane.
+  template <typename Func>
+  batch transform(Func const& f) const;
+
+  // Apply f to each pair of lanes.
+  template <typename Func>
+  batch transform(batch const& cb, Func const& f) const;
+};
+
+template <typename RealType, size_t Lanes>
+constexpr size_t batch<RealType, Lanes>::lanes;
+
+template <typename RealType, size_t Lanes>
+batch<RealType, Lanes>::batch(RealType const& ca) {
+  for (size_t i = 0; i < Lanes; ++i)
+    v[i] = ca;
+}
+
+template <typename RealType, size_t Lanes>
+template <typename RealType2, typename>
+batch<RealType, Lanes>::batch(RealType2 const& ca) : batch(static_cast<RealType>(ca)) {}
+
+template <typename RealType, size_t Lanes>
+batch<RealType, Lanes>::batch(std::array<RealType, Lanes> const& ca) : v(ca) {}
+
+template <typename RealType, size_t Lanes>
+RealType& batch<RealType, Lanes>::operator[](size_t lane) {
+  return v[lane];
+}
+
+template <typename RealType, size_t Lanes>
+RealType const& batch<RealType, Lanes>::operator[](size_t lane) const {
+  return v[lane];
+}
+
+template <typename RealType, size_t Lanes>
+batch<RealType, Lanes>& batch<RealType, Lanes>::operator+=(batch const& cb) {
+  for (size_t i = 0; i < Lanes; ++i)
+    v[i] += cb.v[i];
+  return *this;
+}
+
+template <typename RealType, size_t Lanes>
+batch<RealType, Lanes>& batch<RealType, Lanes>::operator-=(batch const& cb) {
+  for (size_t i = 0; i < Lanes; ++i)
+    v[i] -= cb.v[i];
+  return *this;
+}
+
+template <typename RealType, size_t Lanes>
+batch<RealType, Lanes>& batch<RealType, Lanes>::operator*=(batch const& cb) {
+  for (size_t i = 0; i < Lanes; ++i)
+    v[i] *= cb.v[i];
+  return *this;
+}
+
+template <typename RealType, size_t Lanes>
+batch<RealType, Lanes>& batch<RealType, Lanes>::operator/=(batch const& cb) {
+  for (size_t i = 0; i < Lanes; ++i)
+    v[i] /= cb.v[i];
+  return *this;
+}
+
+template <typename RealType, size_t Lanes>
+batch<RealType, Lanes> batch<RealType, Lanes>::operator-() const {
+  batch retval;
+  for (size_t i = 0; i < Lanes; ++i)
+    retval.v[i] = -v[i];
+  return retval;
+}
+
+template <typename RealType, size_t Lanes>
+batch<RealType, Lanes> const& batch<RealType, Lanes>::operator+() const {
+  return *this;
+}
+
+template <typename RealType, size_t Lanes>
+template <typename Func>
+batch<RealType, Lanes> batch<RealType, Lanes>::transform(Func const& f) const {
+  batch retval;
+  for (size_t i = 0; i < Lanes; ++i)
+    retval.v[i] = f(v[i]);
+  return retval;
+}
+
+template <typename RealType, size_t Lanes>
+template <typename Func>
+batch<RealType, Lanes> batch<RealType, Lanes>::transform(batch const& cb, Func const& f) const {
+  batch retval;
+  for (size_t i = 0; i < Lanes; ++i)
+    retval.v[i] = f(v[i], cb.v[i]);
+  return retval;
+}
+
+template <typename RealType, size_t Lanes>
+struct get_lane_type<batch<RealType, Lanes>> {
+  using type = RealType;
+};
+
+// Binary arithmetic between two batches, or a batch and a value that is broadcast to all lanes.
+
+#define BOOST_AUTODIFF_BATCH_BINARY_OPERATOR(op)                                                      \
+  template <typename RealType, size_t Lanes>                                                          \
+  batch<RealType, Lanes> operator op(batch<RealType, Lanes> const& ca, batch<RealType, Lanes> const& cb) { \
+    batch<RealType, Lanes> retval(ca);                                                                \
+    return retval op## = cb;                                                                          \
+  }                                                                                                   \
+  template <typename RealType, size_t Lanes, typename RealType2>                                      \
+  typename std::enable_if<std::is_arithmetic<RealType2>::value, batch<RealType, Lanes>>::type operator op( \
+      batch<RealType, Lanes> const& ca, RealType2 const& cb) {                                        \
+    batch<RealType, Lanes> retval(ca);                                                                \
+    return retval op## = batch<RealType, Lanes>(cb);                                                  \
+  }                                                                                                   \
+  template <typename RealType, size_t Lanes, typename RealType2>                                      \
+  typename std::enable_if<std::is_arithmetic<RealType2>::value, batch<RealType, Lanes>>::type operator op( \
+      RealType2 const& ca, batch<RealType, Lanes> const& cb) {                                        \
+    batch<RealType, Lanes> retval(ca);                                                                \
+    return retval op## = cb;                                                                          \
+  }
+
+BOOST_AUTODIFF_BATCH_BINARY_OPERATOR(+)
+BOOST_AUTODIFF_BATCH_BINARY_OPERATOR(-)
+BOOST_AUTODIFF_BATCH_BINARY_OPERATOR(*)
+BOOST_AUTODIFF_BATCH_BINARY_OPERATOR(/)
+
+#undef BOOST_AUTODIFF_BATCH_BINARY_OPERATOR
+
+// Comparisons are true if true for all lanes, and != is true if true for any lane.
+
+#define BOOST_AUTODIFF_BATCH_COMPARISON(op)                                                           \
+  template <typename RealType, size_t Lanes>                                                          \
+  bool operator op(batch<RealType, Lanes> const& ca, batch<RealType, Lanes> const& cb) {              \
+    for (size_t i = 0; i < Lanes; ++i)                                                                \
+      if (!(ca[i] op cb[i]))                                                                          \
+        return false;                                                                                 \
+    return true;                                                                                      \
+  }                                                                                                   \
+  template <typename RealType, size_t Lanes, typename RealType2>                                      \
+  typename std::enable_if<std::is_arithmetic<RealType2>::value, bool>::type operator op(              \
+      batch<RealType, Lanes> const& ca, RealType2 const& cb) {                                        \
+    return ca op batch<RealType, Lanes>(cb);                                                          \
+  }                                                                                                   \
+  template <typename RealType, size_t Lanes, typename RealType2>                                      \
+  typename std::enable_if<std::is_arithmetic<RealType2>::value, bool>::type operator op(              \
+      RealType2 const& ca, batch<RealType, Lanes> const& cb) {                                        \
+    return batch<RealType, Lanes>(ca) op cb;                                                          \
+  }
+
+BOOST_AUTODIFF_BATCH_COMPARISON(==)
+BOOST_AUTODIFF_BATCH_COMPARISON(<)
+BOOST_AUTODIFF_BATCH_COMPARISON(<=)
+BOOST_AUTODIFF_BATCH_COMPARISON(>)
+BOOST_AUTODIFF_BATCH_COMPARISON(>=)
+
+#undef BOOST_AUTODIFF_BATCH_COMPARISON
+
+template <typename RealType, size_t Lanes>
+bool operator!=(batch<RealType, Lanes> const& ca, batch<RealType, Lanes> const& cb) {
+  return !(ca == cb);
+}
+
+template <typename RealType, size_t Lanes, typename RealType2>
+typename std::enable_if<std::is_arithmetic<RealType2>::value, bool>::type operator!=(
+    batch<RealType, Lanes> const& ca,
+    RealType2 const& cb) {
+  return !(ca == cb);
+}
+
+template <typename RealType, size_t Lanes, typename RealType2>
+typename std::enable_if<std::is_arithmetic<RealType2>::value, bool>::type operator!=(
+    RealType2 const& ca,
+    batch<RealType, Lanes> const& cb) {
+  return !(ca == cb);
+}
+
+template <typename RealType, size_t Lanes>
+std::ostream& operator<<(std::ostream& out, batch<RealType, Lanes> const& cb) {
+  out << '[' << cb[0];
+  for (size_t i = 1; i < Lanes; ++i)
+    out << ',' << cb[i];
+  return out << ']';
+}
+
+// Functions of a single batch are applied lane by lane. These are found by argument-dependent lookup from
+// within the fvar functions in autodiff.hpp. Their return type removes them from overload resolution unless
+// RealType is a floating point type, as for the explicit template arguments of the fvar functions below.
+
+template <typename RealType, size_t Lanes>
+using batch_result =
+    typename std::enable_if<std::is_floating_point<RealType>::value, batch<RealType, Lanes>>::type;
+
+#define BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(name, ...)                                                \
+  template <typename RealType, size_t Lanes>                                                          \
+  batch_result<RealType, Lanes> name(batch<RealType, Lanes> const& cb) {                              \
+    __VA_ARGS__;                                                                                      \
+    return cb.transform([](RealType const& x) { return static_cast<RealType>(name(x)); });            \
+  }
+
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(abs, using std::abs)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(acos, using std::acos)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(acosh, using boost::math::acosh)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(asin, using std::asin)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(asinh, using boost::math::asinh)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(atan, using std::atan)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(atanh, using boost::math::atanh)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(cbrt, using boost::math::cbrt)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(ceil, using std::ceil)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(cos, using std::cos)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(cosh, using std::cosh)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(digamma, using boost::math::digamma)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(erf, using boost::math::erf)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(erfc, using boost::math::erfc)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(exp, using std::exp)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(exp2, using std::exp2)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(expm1, using boost::math::expm1)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(fabs, using std::fabs)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(floor, using std::floor)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(lambert_w0, using boost::math::lambert_w0)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(lgamma, using std::lgamma)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(log, using std::log)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(log1p, using boost::math::log1p)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(round, using boost::math::round)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(sin, using std::sin)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(sinh, using std::sinh)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(sqrt, using std::sqrt)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(tan, using std::tan)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(tanh, using std::tanh)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(tgamma, using std::tgamma)
+BOOST_AUTODIFF_BATCH_UNARY_FUNCTION(trunc, using boost::math::trunc)
+
+#undef BOOST_AUTODIFF_BATCH_UNARY_FUNCTION
+
+// The derivatives of digamma and lgamma.
+template <typename RealType, size_t Lanes>
+batch_result<RealType, Lanes> polygamma(int n, batch<RealType, Lanes> const& cb) {
+  return cb.transform([n](RealType const& x) { return boost::math::polygamma(n, x); });
+}
+
+#define BOOST_AUTODIFF_BATCH_BINARY_FUNCTION(name, ...)                                               \
+  template <typename RealType, size_t Lanes>                                                          \
+  batch_result<RealType, Lanes> name(batch<RealType, Lanes> const& ca, batch<RealType, Lanes> const& cb) { \
+    __VA_ARGS__;                                                                                      \
+    return ca.transform(                                                                              \
+        cb, [](RealType const& x, RealType const& y) { return static_cast<RealType>(name(x, y)); });  \
+  }                                                                                                   \
+  template <typename RealType, size_t Lanes>                                                          \
+  batch_result<RealType, Lanes> name(batch<RealType, Lanes> const& ca, RealType const& cb) {          \
+    return name(ca, batch<RealType, Lanes>(cb));                                                      \
+  }                                                                                                   \
+  template <typename RealType, size_t Lanes>                                                          \
+  batch_result<RealType, Lanes> name(RealType const& ca, batch<RealType, Lanes> const& cb) {          \
+    return name(batch<RealType, Lanes>(ca), cb);                                                      \
+  }
+
+BOOST_AUTODIFF_BATCH_BINARY_FUNCTION(atan2, using std::atan2)
+BOOST_AUTODIFF_BATCH_BINARY_FUNCTION(fmod, using std::fmod)
+BOOST_AUTODIFF_BATCH_BINARY_FUNCTION(pow, using std::pow)
+
+#undef BOOST_AUTODIFF_BATCH_BINARY_FUNCTION
+
+// a *= c in the lanes where a is not 0, as multiply_assign_nonzero() in autodiff.hpp does for a scalar.
+template <typename RealType, size_t Lanes>
+void multiply_assign_nonzero(batch<RealType, Lanes>& a, batch<RealType, Lanes> const& c) {
+  for (size_t i = 0; i < Lanes; ++i)
+    if (a[i] != 0)
+      a[i] *= c[i];
+}
+
+// As add_product_nonzero() and add_scaled_nonzero() in autodiff.hpp, for each lane.
+template <typename RealType, size_t Lanes>
+void add_product_nonzero(batch<RealType, Lanes>& r,
+                         batch<RealType, Lanes> const& x,
+                         batch<RealType, Lanes> const& y) {
+  for (size_t i = 0; i < Lanes; ++i)
+    if (x[i] != 0 && y[i] != 0)
+      r[i] += x[i] * y[i];
+}
+
+template <typename RealType, size_t Lanes>
+void add_scaled_nonzero(batch<RealType, Lanes>& r,
+                        batch<RealType, Lanes> const& a,
+                        batch<RealType, Lanes> const& c) {
+  for (size_t i = 0; i < Lanes; ++i)
+    if (a[i] != 0)
+      r[i] += c[i] * a[i];
+}
+
+template <typename RealType>
+struct is_batch : std::false_type {};
+
+template <typename RealType, size_t Lanes>
+struct is_batch<batch<RealType, Lanes>> : std::true_type {};
+
+// fvar of the lane type of a batch, in place of the batch at its root.
+template <typename RealType>
+struct get_lane_fvar {
+  using type = typename get_lane_type<RealType>::type;
+};
+
+template <typename RealType, size_t Order>
+struct get_lane_fvar<fvar<RealType, Order>> {
+  using type = fvar<typename get_lane_fvar<RealType>::type, Order>;
+};
+
+template <typename RealType, size_t Lanes>
+RealType get_lane(batch<RealType, Lanes> const& cb, size_t lane) {
+  return cb[lane];
+}
+
+template <typename RealType, size_t Order>
+typename get_lane_fvar<fvar<RealType, Order>>::type get_lane(fvar<RealType, Order> const& cr, size_t lane) {
+  typename get_lane_fvar<fvar<RealType, Order>>::type retval;
+  for (size_t i = 0; i <= Order; ++i)
+    fvar_series_access::data(retval)[i] = get_lane(fvar_series_access::data(cr)[i], lane);
+  return retval;
+}
+
+template <typename RealType, size_t Lanes>
+void set_lane(batch<RealType, Lanes>& b, size_t lane, RealType const& ca) {
+  b[lane] = ca;
+}
+
+template <typename RealType, size_t Order>
+void set_lane(fvar<RealType, Order>& r,
+              size_t lane,
+              typename get_lane_fvar<fvar<RealType, Order>>::type const& ca) {
+  for (size_t i = 0; i <= Order; ++i)
+    set_lane(fvar_series_access::data(r)[i], lane, fvar_series_access::data(ca)[i]);
+}
+
+// Evaluate f separately for each lane of the arguments, as for a root_type of the lane type.
+template <typename ReturnType, typename... Args, typename Func>
+ReturnType lanewise(Func const& f, Args const&... args) {
+  ReturnType retval;
+  for (size_t lane = 0; lane < get_root_type<ReturnType>::type::lanes; ++lane)
+    set_lane(retval, lane, f(get_lane(args, lane)...));
+  return retval;
+}
+
+// The fvar functions in autodiff.hpp that branch on the value of their argument are overloaded below. If all
+// lanes take the same branch, as given by the condition on the root value x0, then the function is evaluated
+// for all lanes together, otherwise lane by lane. Each calls the function of autodiff.hpp by its explicit
+// template arguments, which do not match the overloads below.
+
+#define BOOST_AUTODIFF_BATCH_FVAR_FUNCTION(name, condition)                                           \
+  struct name##_lanes {                                                                               \
+    template <typename... Args>                                                                       \
+    auto operator()(Args const&... args) const -> decltype(name(args...)) {                           \
+      return name(args...);                                                                           \
+    }                                                                                                 \
+  };                                                                                                  \
+  template <typename RealType, size_t Lanes, size_t Order>                                            \
+  fvar<batch<RealType, Lanes>, Order> name(fvar<batch<RealType, Lanes>, Order> const& cr) {           \
+    batch<RealType, Lanes> const x0 = static_cast<batch<RealType, Lanes>>(cr);                        \
+    if (condition)                                                                                    \
+      return name<batch<RealType, Lanes>, Order>(cr);                                                 \
+    return lanewise<fvar<batch<RealType, Lanes>, Order>>(name##_lanes(), cr);                         \
+  }                                                                                                   \
+  template <typename RealType, size_t Order1, size_t Order2>                                          \
+  typename std::enable_if<is_batch<typename get_root_type<RealType>::type>::value,                    \
+                          fvar<fvar<RealType, Order1>, Order2>>::type                                 \
+  name(fvar<fvar<RealType, Order1>, Order2> const& cr) {                                              \
+    typename get_root_type<RealType>::type const x0 =                                                 \
+        static_cast<typename get_root_type<RealType>::type>(cr);                                      \
+    if (condition)                                                                                    \
+      return name<fvar<RealType, Order1>, Order2>(cr);                                                \
+    return lanewise<fvar<fvar<RealType, Order1>, Order2>>(name##_lanes(), cr);                        \
+  }
+
+BOOST_AUTODIFF_BATCH_FVAR_FUNCTION(acos, -1 < x0 && x0 < 1)
+BOOST_AUTODIFF_BATCH_FVAR_FUNCTION(acosh, 1 < x0)
+BOOST_AUTODIFF_BATCH_FVAR_FUNCTION(asin, -1 < x0 && x0 < 1)
+BOOST_AUTODIFF_BATCH_FVAR_FUNCTION(atanh, -1 < x0 && x0 < 1)
+BOOST_AUTODIFF_BATCH_FVAR_FUNCTION(fabs, x0 < 0 || 0 < x0 || x0 == 0)
+BOOST_AUTODIFF_BATCH_FVAR_FUNCTION(fvar_inverse, 0 < fabs(x0) || x0 == 0)
+BOOST_AUTODIFF_BATCH_FVAR_FUNCTION(log, 0 < x0)
+BOOST_AUTODIFF_BATCH_FVAR_FUNCTION(sinc, 0 < fabs(x0) || x0 == 0)
+BOOST_AUTODIFF_BATCH_FVAR_FUNCTION(sqrt, 0 < x0)
+BOOST_AUTODIFF_BATCH_FVAR_FUNCTION(tgamma, x0 < 0 || 0 <= x0)
+
+#undef BOOST_AUTODIFF_BATCH_FVAR_FUNCTION
+
+// As above for functions of two arguments, with root values a0 and b0. At least one argument is an fvar. The
+// condition for two fvar arguments, either of which may be nested, is given separately, as it may branch
+// differently from the others.
+
+template <typename RealType, size_t Lanes, size_t Order>
+using batch_fvar = fvar<batch<RealType, Lanes>, Order>;
+
+#define BOOST_AUTODIFF_BATCH_FVAR_BINARY_FUNCTION(name, condition, fvar_condition)                    \
+  struct name##_lanes {                                                                               \
+    template <typename... Args>                                                                       \
+    auto operator()(Args const&... args) const -> decltype(name(args...)) {                           \
+      return name(args...);                                                                           \
+    }                                                                                                 \
+  };                                                                                                  \
+  template <typename RealType, size_t Lanes, size_t Order>                                            \
+  batch_fvar<RealType, Lanes, Order> name(                                                            \
+      batch_fvar<RealType, Lanes, Order> const& cr,                                                   \
+      typename batch_fvar<RealType, Lanes, Order>::root_type const& b0) {                             \
+    batch<RealType, Lanes> const a0 = static_cast<batch<RealType, Lanes>>(cr);                        \
+    if (condition)                                                                                    \
+      return name<batch<RealType, Lanes>, Order>(cr, b0);                                             \
+    return lanewise<batch_fvar<RealType, Lanes, Order>>(name##_lanes(), cr, b0);                      \
+  }                                                                                                   \
+  template <typename RealType, size_t Lanes, size_t Order>                                            \
+  batch_fvar<RealType, Lanes, Order> name(                                                            \
+      typename batch_fvar<RealType, Lanes, Order>::root_type const& a0,                               \
+      batch_fvar<RealType, Lanes, Order> const& cr) {                                                 \
+    batch<RealType, Lanes> const b0 = static_cast<batch<RealType, Lanes>>(cr);                        \
+    (void)b0;                                                                                         \
+    if (condition)                                                                                    \
+      return name<batch<RealType, Lanes>, Order>(a0, cr);                                             \
+    return lanewise<batch_fvar<RealType, Lanes, Order>>(name##_lanes(), a0, cr);                      \
+  }                                                                                                   \
+  template <typename RealType1, size_t Order1, typename RealType2, size_t Order2>                     \
+  promote<fvar<RealType1, Order1>, fvar<RealType2, Order2>> name##_fvars(                             \
+      fvar<RealType1, Order1> const& cr1,                                                             \
+      fvar<RealType2, Order2> const& cr2) {                                                           \
+    using return_type = promote<fvar<RealType1, Order1>, fvar<RealType2, Order2>>;                    \
+    using root_type = typename return_type::root_type;                                                \
+    root_type const a0 = static_cast<root_type>(cr1);                                                 \
+    root_type const b0 = static_cast<root_type>(cr2);                                                 \
+    (void)b0;                                                                                         \
+    if (fvar_condition)                                                                               \
+      return name<RealType1, Order1, RealType2, Order2>(cr1, cr2);                                    \
+    return lanewise<return_type>(name##_lanes(), cr1, cr2);                                           \
+  }                                                                                                   \
+  template <typename RealType, size_t Lanes, size_t Order1, size_t Order2>                            \
+  promote<batch_fvar<RealType, Lanes, Order1>, batch_fvar<RealType, Lanes, Order2>> name(             \
+      batch_fvar<RealType, Lanes, Order1> const& cr1,                                                 \
+      batch_fvar<RealType, Lanes, Order2> const& cr2) {                                               \
+    return name##_fvars(cr1, cr2);                                                                    \
+  }                                                                                                   \
+  template <typename RealType1, size_t Order1, size_t Order2, typename RealType2, size_t Order3>      \
+  typename std::enable_if<is_batch<typename get_root_type<RealType1>::type>::value,                   \
+                          promote<fvar<fvar<RealType1, Order1>, Order2>, fvar<RealType2, Order3>>>::type\
+  name(fvar<fvar<RealType1, Order1>, Order2> const& cr1, fvar<RealType2, Order3> const& cr2) {        \
+    return name##_fvars(cr1, cr2);                                                                    \
+  }                                                                                                   \
+  template <typename RealType, size_t Lanes, size_t Order1, typename RealType2, size_t Order2, size_t Order3>\
+  promote<batch_fvar<RealType, Lanes, Order1>, fvar<fvar<RealType2, Order2>, Order3>> name(           \
+      batch_fvar<RealType, Lanes, Order1> const& cr1,                                                 \
+      fvar<fvar<RealType2, Order2>, Order3> const& cr2) {                                             \
+    return name##_fvars(cr1, cr2);                                                                    \
+  }
+
+// pow of two fvar takes a different path for |a0| < epsilon, as in autodiff.hpp.
+#define BOOST_AUTODIFF_BATCH_ATAN2_CONDITION \
+  (fabs(a0) <= fabs(b0) && 0 < fabs(b0)) || (fabs(b0) <= fabs(a0) && 0 < fabs(a0))
+#define BOOST_AUTODIFF_BATCH_POW_CONDITION                                                                   \
+  fast_math::value || std::numeric_limits<typename get_lane_type<root_type>::type>::epsilon() <= fabs(a0) || \
+      fabs(a0) < std::numeric_limits<typename get_lane_type<root_type>::type>::epsilon()
+
+BOOST_AUTODIFF_BATCH_FVAR_BINARY_FUNCTION(atan2,
+                                          BOOST_AUTODIFF_BATCH_ATAN2_CONDITION,
+                                          BOOST_AUTODIFF_BATCH_ATAN2_CONDITION)
+BOOST_AUTODIFF_BATCH_FVAR_BINARY_FUNCTION(pow, 0 < a0 || a0 < 0, BOOST_AUTODIFF_BATCH_POW_CONDITION)
+
+#undef BOOST_AUTODIFF_BATCH_POW_CONDITION
+#undef BOOST_AUTODIFF_BATCH_ATAN2_CONDITION
+
+#undef BOOST_AUTODIFF_BATCH_FVAR_BINARY_FUNCTION
+
+}  // namespace detail
+
+template <typename RealType, size_t Lanes>
+using batch = detail::batch<RealType, Lanes>;
+
+}  // namespace autodiff_v1
+}  // namespace differentiation
+}  // namespace math
+}  // namespace boost
+
+namespace std {
+
+// boost::math::factorial(), constants and tools::epsilon() for a batch are those of its lane type.
+template <typename RealType, size_t Lanes>
+class numeric_limits<boost::math::differentiation::detail::batch<RealType, Lanes>>
+    : public numeric_limits<RealType> {};
+
+}  // namespace std
+
+#endif  // BOOST_MATH_DIFFERENTIATION_AUTODIFF_BATCH_HPP
@@ -75,12 +75,12 @@ get_type_at<RealType, sizeof...(Orders)> fvar<RealType, Order>::at(size_t order,
 }
 
 template <typename T, typename... Ts>
-constexpr T product(Ts...) {
+constexpr T product(Ts const&...) {
   return static_cast<T>(1);
 }
 
 template <typename T, typename... Ts>
-constexpr T product(T factor, Ts... factors) {
+constexpr T product(T const& factor, Ts const&... factors) {
   return factor * product<T>(factors...);
 }
 
@@ -92,7 +92,7 @@ get_type_at<fvar<RealType, Order>, sizeof...(Orders)> fvar<RealType, Order>::der
   static_assert(sizeof...(Orders) <= depth,
                 "Number of parameters to derivative(...) cannot exceed fvar::depth.");
   return at(static_cast<size_t>(orders)...) *
-         product(boost::math::factorial<root_type>(static_cast<unsigned>(orders))...);
+         product(factorial<root_type, order_sum>(static_cast<unsigned>(orders))...);
 }
 
 template <typename RootType, typename Func>
@@ -166,13 +166,13 @@ promote<fvar<RealType, Order>, Fvar, Fvars...> fvar<RealType, Order>::apply_deri
   using return_type = promote<fvar<RealType, Order>, Fvar, Fvars...>;
   return_type accumulator =
       cr.apply_derivatives(
-          order - i, Curry<typename return_type::root_type, Func>(f, i), std::forward<Fvars>(fvars)...) /
-      factorial<root_type>(static_cast<unsigned>(i));
+          order - i, Curry<typename return_type::root_type, Func>(f, i), std::forward<Fvars>(fvars)...) *
+      inverse_factorial<root_type, order_sum>(static_cast<unsigned>(i));
   while (i--)
     (accumulator *= epsilon) +=
         cr.apply_derivatives(
-            order - i, Curry<typename return_type::root_type, Func>(f, i), std::forward<Fvars>(fvars)...) /
-        factorial<root_type>(static_cast<unsigned>(i));
+            order - i, Curry<typename return_type::root_type, Func>(f, i), std::forward<Fvars>(fvars)...) *
+        inverse_factorial<root_type, order_sum>(static_cast<unsigned>(i));
   return accumulator;
 }
 
@@ -195,8 +195,8 @@ promote<fvar<RealType, Order>, Fvar, Fvars...> fvar<RealType, Order>::apply_deri
         i,
         0,
         cr.apply_derivatives_nonhorner(
-            order - i, Curry<typename return_type::root_type, Func>(f, i), std::forward<Fvars>(fvars)...) /
-            factorial<root_type>(static_cast<unsigned>(i)),
+            order - i, Curry<typename return_type::root_type, Func>(f, i), std::forward<Fvars>(fvars)...) *
+            inverse_factorial<root_type, order_sum>(static_cast<unsigned>(i)),
         0,
         0);
   }
@@ -235,7 +235,7 @@ fvar<RealType, Order> fvar<RealType, Order>::epsilon_multiply_cpp11(std::false_t
   size_t const i_max = m0 + m1 < Order ? Order - (m0 + m1) : 0;
   fvar<RealType, Order> retval = fvar<RealType, Order>();
   for (size_t i = 0, j = Order; i <= i_max; ++i, --j)
-    retval.v[j] = std::inner_product(
+    retval.v[j] = detail::inner_product(
         v.cbegin() + ssize_t(m0), v.cend() - ssize_t(i + m1), cr.v.crbegin() + ssize_t(i + m0), zero);
   return retval;
 }
@@ -271,8 +271,10 @@ fvar<RealType, Order> fvar<RealType, Order>::epsilon_multiply_cpp11(std::false_t
   fvar<RealType, Order> retval(*this);
   size_t const m0 = order_sum + isum0 < Order + z0 ? Order + z0 - (order_sum + isum0) : 0;
   for (size_t i = m0; i <= Order; ++i)
-    if (retval.v[i] != static_cast<RealType>(0))
+    if (fast_math::value)
       retval.v[i] *= ca;
+    else
+      multiply_assign_nonzero(retval.v[i], ca);
   return retval;
 }
 
@@ -301,11 +303,16 @@ fvar<RealType, Order>& fvar<RealType, Order>::multiply_assign_by_root_type_cpp11
                                                                                  bool is_root,
                                                                                  RootType const& ca) {
   auto itr = v.begin();
-  if (is_root || *itr != 0)
-    *itr *= ca;  // Skip multiplication of 0 by ca=inf to avoid nan, except when is_root.
+  // Skip multiplication of 0 by ca=inf to avoid nan, except when is_root.
+  if (fast_math::value || is_root)
+    *itr *= ca;
+  else
+    multiply_assign_nonzero(*itr, ca);
   for (++itr; itr != v.end(); ++itr)
-    if (*itr != 0)
+    if (fast_math::value)
       *itr *= ca;
+    else
+      multiply_assign_nonzero(*itr, ca);
   return *this;
 }
 
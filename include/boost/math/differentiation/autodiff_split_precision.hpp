@@ -0,0 +1,542 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+// Notes:
+//  * spvar<RealType,LowType,Order,K,Vars> is a truncated Taylor polynomial in Vars variables, that holds the
+//    monomials of total degree <= Order in the graded order of tdvar<RealType,Vars,Order>. Those of total
+//    degree < K (the value and the derivatives of order < K) are held in RealType and the rest in a cheaper
+//    LowType. E.g. spvar<cpp_bin_float_50,double,10,2> carries the value and first derivative of a function
+//    of one variable to 50 digits, and the derivatives of orders 2 to 10 to double precision, and
+//    spvar<cpp_bin_float_50,double,2,2,4> carries a price and its 4 first order Greeks to 50 digits, and its
+//    10 second order Greeks to double precision.
+//  * Coefficient k of a product or quotient only depends on the monomials that divide monomial k, which are
+//    of lower total degree or k itself. It is summed in RealType for total degree < K, and in LowType from
+//    the coefficients rounded to LowType from there on. The coefficients below total degree K are then
+//    exactly those of tdvar<RealType,Vars,K-1>.
+//  * All other functions are evaluated by composing their Taylor coefficients about the constant term with
+//    *this, the first K from fvar<RealType,K-1> and the rest from fvar<LowType,Order>. So each function costs
+//    one fvar of each type, rather than an fvar<RealType,Order>.
+//  * Use make_spvar<RealType,LowType,Order,K>(x) to create the independent variable of a function of one
+//    variable, or make_sptuple<RealType,LowType,Order,K>(x, y, ...) those of a function of several. Extract
+//    the mixed partial derivative d^(i+j+...)/(dx^i dy^j ...) for i+j+... <= Order as a RealType by
+//    derivative(i, j, ...).
+
+#ifndef BOOST_MATH_DIFFERENTIATION_AUTODIFF_SPLIT_PRECISION_HPP
+#define BOOST_MATH_DIFFERENTIATION_AUTODIFF_SPLIT_PRECISION_HPP
+
+#include <boost/math/differentiation/autodiff.hpp>
+#include <boost/mp11/integer_sequence.hpp>
+
+#include "detail/autodiff_composed.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace boost {
+namespace math {
+namespace differentiation {
+inline namespace autodiff_v1 {
+namespace detail {
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars = 1>
+class spvar {
+  static_assert(0 < K && K <= Order, "spvar must have between 1 and Order total degrees of RealType.");
+
+  using table_type = monomial_table<Vars, Order>;
+
+  static constexpr size_t high_size = binomial_coefficient(Vars + K - 1, Vars);  // Monomials of degree < K.
+
+  std::array<RealType, high_size> hi;  // Monomials [0,high_size).
+
+  std::array<LowType, table_type::size - high_size> lo;  // Monomials [high_size,size).
+
+ public:
+  using root_type = RealType;
+
+  using low_type = LowType;
+
+  spvar() = default;
+
+  // Initialize independent variable number variable. Will throw std::out_of_range if Vars <= variable.
+  spvar(root_type const& ca, size_t variable);
+
+  // Initialize a constant.
+  spvar(root_type const& ca);
+
+  spvar& operator+=(spvar const&);
+
+  spvar& operator+=(root_type const&);
+
+  spvar& operator-=(spvar const&);
+
+  spvar& operator-=(root_type const&);
+
+  spvar& operator*=(spvar const&);
+
+  spvar& operator*=(root_type const&);
+
+  spvar& operator/=(spvar const&);
+
+  spvar& operator/=(root_type const&);
+
+  spvar operator-() const;
+
+  spvar const& operator+() const;
+
+  spvar operator+(spvar const&) const;
+
+  spvar operator+(root_type const&) const;
+
+  spvar operator-(spvar const&) const;
+
+  spvar operator-(root_type const&) const;
+
+  spvar operator*(spvar const&)const;
+
+  spvar operator*(root_type const&)const;
+
+  spvar operator/(spvar const&) const;
+
+  spvar operator/(root_type const&) const;
+
+  // Taylor coefficient of x0^orders0 * x1^orders1 * ..., as a RealType.
+  // Will throw std::out_of_range if Order < sum of orders.
+  template <typename... Orders>
+  root_type at(Orders... orders) const;
+
+  // Mixed partial derivative d^(orders0+orders1+...)/(dx0^orders0 dx1^orders1 ...), as a RealType.
+  // Will throw std::out_of_range if Order < sum of orders.
+  template <typename... Orders>
+  root_type derivative(Orders... orders) const;
+
+  spvar inverse() const;  // Multiplicative inverse.
+
+  spvar& negate();  // Negate and return reference to *this.
+
+  static constexpr size_t size = table_type::size;  // Number of monomials of total degree <= Order.
+
+  explicit operator root_type() const;
+
+  template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+  explicit operator T() const;
+
+  spvar& set_root(root_type const&);
+
+  // Returns f(*this), given the Taylor coefficients of a univariate function about the constant term x0 of
+  // *this, those of order < K in f_high, e.g. f_high = exp(make_fvar<RealType,K-1>(x0)), and the rest in
+  // f_low, e.g. f_low = exp(make_fvar<LowType,Order>(static_cast<LowType>(x0))).
+  spvar compose(fvar<RealType, K - 1> const& f_high, fvar<LowType, Order> const& f_low) const;
+
+  // Returns f(*this), given a function object f of either fvar, by compose() with the f of each at the
+  // constant term of *this.
+  template <typename Func>
+  spvar apply(Func const& f) const;
+
+ private:
+  // All coefficients, rounded to LowType.
+  std::array<LowType, size> lowered() const;
+
+  template <typename RealType2, typename LowType2, size_t Order2, size_t K2, size_t Vars2>
+  friend std::ostream& operator<<(std::ostream&, spvar<RealType2, LowType2, Order2, K2, Vars2> const&);
+};
+
+// Comparisons and functions of an spvar are those of detail/autodiff_composed.hpp.
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+struct is_composed<spvar<RealType, LowType, Order, K, Vars>> : std::true_type {};
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+constexpr size_t spvar<RealType, LowType, Order, K, Vars>::high_size;
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+constexpr size_t spvar<RealType, LowType, Order, K, Vars>::size;
+
+// The monomial of x_variable is 1 + variable, of total degree 1, which is held in RealType for 1 < K.
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>::spvar(root_type const& ca, size_t variable) : spvar(ca) {
+  if (Vars <= variable)
+    throw std::out_of_range("spvar: variable must be less than Vars.");
+  if BOOST_AUTODIFF_IF_CONSTEXPR (1 < K)
+    hi[1 + variable] = static_cast<root_type>(1);
+  else
+    lo[variable] = static_cast<LowType>(1);
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>::spvar(root_type const& ca) {
+  hi.front() = ca;
+  std::fill(hi.begin() + 1, hi.end(), static_cast<root_type>(0));
+  std::fill(lo.begin(), lo.end(), static_cast<LowType>(0));
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>& spvar<RealType, LowType, Order, K, Vars>::operator+=(
+    spvar const& cr) {
+  for (size_t i = 0; i < high_size; ++i)
+    hi[i] += cr.hi[i];
+  for (size_t i = 0; i < lo.size(); ++i)
+    lo[i] += cr.lo[i];
+  return *this;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>& spvar<RealType, LowType, Order, K, Vars>::operator+=(
+    root_type const& ca) {
+  hi.front() += ca;
+  return *this;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>& spvar<RealType, LowType, Order, K, Vars>::operator-=(
+    spvar const& cr) {
+  for (size_t i = 0; i < high_size; ++i)
+    hi[i] -= cr.hi[i];
+  for (size_t i = 0; i < lo.size(); ++i)
+    lo[i] -= cr.lo[i];
+  return *this;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>& spvar<RealType, LowType, Order, K, Vars>::operator-=(
+    root_type const& ca) {
+  hi.front() -= ca;
+  return *this;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>& spvar<RealType, LowType, Order, K, Vars>::operator*=(
+    spvar const& cr) {
+  return *this = *this * cr;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>& spvar<RealType, LowType, Order, K, Vars>::operator*=(
+    root_type const& ca) {
+  for (RealType& x : hi)
+    x *= ca;
+  LowType const c = static_cast<LowType>(ca);
+  for (LowType& x : lo)
+    x *= c;
+  return *this;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>& spvar<RealType, LowType, Order, K, Vars>::operator/=(
+    spvar const& cr) {
+  return *this = *this / cr;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>& spvar<RealType, LowType, Order, K, Vars>::operator/=(
+    root_type const& ca) {
+  for (RealType& x : hi)
+    x /= ca;
+  LowType const c = static_cast<LowType>(ca);
+  for (LowType& x : lo)
+    x /= c;
+  return *this;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::operator-() const {
+  spvar retval(*this);
+  return retval.negate();
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> const& spvar<RealType, LowType, Order, K, Vars>::operator+() const {
+  return *this;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::operator+(
+    spvar const& cr) const {
+  spvar retval(*this);
+  return retval += cr;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::operator+(
+    root_type const& ca) const {
+  spvar retval(*this);
+  return retval += ca;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> operator+(
+    typename spvar<RealType, LowType, Order, K, Vars>::root_type const& ca,
+    spvar<RealType, LowType, Order, K, Vars> const& cr) {
+  return cr + ca;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::operator-(
+    spvar const& cr) const {
+  spvar retval(*this);
+  return retval -= cr;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::operator-(
+    root_type const& ca) const {
+  spvar retval(*this);
+  return retval -= ca;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> operator-(
+    typename spvar<RealType, LowType, Order, K, Vars>::root_type const& ca,
+    spvar<RealType, LowType, Order, K, Vars> const& cr) {
+  return -cr += ca;
+}
+
+// Product k only depends on the factors of the monomials that divide k. Those below high_size are all of
+// RealType.
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::operator*(
+    spvar const& cr) const {
+  table_type const& table = get_monomial_table<Vars, Order>();
+  spvar retval;
+  for (size_t k = 0; k < high_size; ++k) {
+    RealType sum = hi[k] * cr.hi.front();
+    for (size_t p = table.product_begin[k] + 1; p < table.product_begin[k + 1]; ++p)
+      sum += hi[table.lhs[p]] * cr.hi[table.rhs[p]];
+    retval.hi[k] = sum;
+  }
+  std::array<LowType, size> const a = lowered();
+  std::array<LowType, size> const b = cr.lowered();
+  for (size_t k = high_size; k < size; ++k) {
+    LowType sum = a[k] * b.front();
+    for (size_t p = table.product_begin[k] + 1; p < table.product_begin[k + 1]; ++p)
+      sum += a[table.lhs[p]] * b[table.rhs[p]];
+    retval.lo[k - high_size] = sum;
+  }
+  return retval;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::operator*(
+    root_type const& ca) const {
+  spvar retval(*this);
+  return retval *= ca;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> operator*(
+    typename spvar<RealType, LowType, Order, K, Vars>::root_type const& ca,
+    spvar<RealType, LowType, Order, K, Vars> const& cr) {
+  return cr * ca;
+}
+
+// Forward substitution, in RealType for the quotients below high_size and in LowType from there on.
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::operator/(
+    spvar const& cr) const {
+  table_type const& table = get_monomial_table<Vars, Order>();
+  spvar retval;
+  std::array<LowType, size> q;
+  for (size_t k = 0; k < high_size; ++k) {
+    RealType sum = hi[k];
+    for (size_t p = table.product_begin[k] + 1; p < table.product_begin[k + 1]; ++p)
+      sum -= retval.hi[table.lhs[p]] * cr.hi[table.rhs[p]];
+    retval.hi[k] = sum / cr.hi.front();
+    q[k] = static_cast<LowType>(retval.hi[k]);
+  }
+  std::array<LowType, size> const b = cr.lowered();
+  for (size_t k = high_size; k < size; ++k) {
+    LowType sum = lo[k - high_size];
+    for (size_t p = table.product_begin[k] + 1; p < table.product_begin[k + 1]; ++p)
+      sum -= q[table.lhs[p]] * b[table.rhs[p]];
+    q[k] = sum / b.front();
+    retval.lo[k - high_size] = q[k];
+  }
+  return retval;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::operator/(
+    root_type const& ca) const {
+  spvar retval(*this);
+  return retval /= ca;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> operator/(
+    typename spvar<RealType, LowType, Order, K, Vars>::root_type const& ca,
+    spvar<RealType, LowType, Order, K, Vars> const& cr) {
+  return spvar<RealType, LowType, Order, K, Vars>(ca) / cr;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+template <typename... Orders>
+RealType spvar<RealType, LowType, Order, K, Vars>::at(Orders... orders) const {
+  static_assert(sizeof...(Orders) == Vars, "Number of orders must match number of variables.");
+  size_t const exponents[Vars]{static_cast<size_t>(orders)...};
+  size_t const k = table_type::index(exponents);
+  return k < high_size ? hi[k] : static_cast<root_type>(lo.at(k - high_size));
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+template <typename... Orders>
+RealType spvar<RealType, LowType, Order, K, Vars>::derivative(Orders... orders) const {
+  static_assert(sizeof...(Orders) == Vars, "Number of orders must match number of variables.");
+  size_t const exponents[Vars]{static_cast<size_t>(orders)...};
+  size_t const k = table_type::index(exponents);
+  if (k < high_size) {
+    RealType retval = hi[k];
+    for (size_t order : exponents)
+      retval *= factorial<RealType, Order>(static_cast<unsigned>(order));
+    return retval;
+  }
+  LowType retval = lo.at(k - high_size);
+  for (size_t order : exponents)
+    retval *= factorial<LowType, Order>(static_cast<unsigned>(order));
+  return static_cast<root_type>(retval);
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::inverse() const {
+  return static_cast<root_type>(1) / *this;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>& spvar<RealType, LowType, Order, K, Vars>::negate() {
+  for (RealType& x : hi)
+    x = -x;
+  for (LowType& x : lo)
+    x = -x;
+  return *this;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>::operator root_type() const {
+  return hi.front();
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+template <typename T, typename>
+spvar<RealType, LowType, Order, K, Vars>::operator T() const {
+  return static_cast<T>(hi.front());
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars>& spvar<RealType, LowType, Order, K, Vars>::set_root(
+    root_type const& root) {
+  hi.front() = root;
+  return *this;
+}
+
+// Horner's method in h = *this - (constant term): f[Order]*h^Order + ... + f[1]*h + f[0]. A term f[i]*h^i
+// only reaches the monomials of total degree >= i, so those below K are summed in RealType from f_high
+// alone, and the rest in LowType from f_low. Each product by h is calculated in place from the highest
+// monomial down, without the pairs (k,0) since the constant term of h is 0.
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::compose(
+    fvar<RealType, K - 1> const& f_high,
+    fvar<LowType, Order> const& f_low) const {
+  table_type const& table = get_monomial_table<Vars, Order>();
+  spvar retval(f_high[K - 1]);
+  for (size_t i = K - 1; i--;) {
+    for (size_t k = high_size; --k;) {
+      RealType sum = static_cast<root_type>(0);
+      for (size_t p = table.product_begin[k] + 1; p < table.product_begin[k + 1]; ++p)
+        sum += retval.hi[table.lhs[p]] * hi[table.rhs[p]];
+      retval.hi[k] = sum;
+    }
+    retval.hi.front() = f_high[i];
+  }
+  std::array<LowType, size> const h = lowered();
+  std::array<LowType, size> r{};
+  r.front() = f_low[Order];
+  for (size_t i = Order; i--;) {
+    for (size_t k = size; --k;) {
+      LowType sum = static_cast<LowType>(0);
+      for (size_t p = table.product_begin[k] + 1; p < table.product_begin[k + 1]; ++p)
+        sum += r[table.lhs[p]] * h[table.rhs[p]];
+      r[k] = sum;
+    }
+    r.front() = f_low[i];
+  }
+  std::copy(r.cbegin() + high_size, r.cend(), retval.lo.begin());
+  return retval;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+template <typename Func>
+spvar<RealType, LowType, Order, K, Vars> spvar<RealType, LowType, Order, K, Vars>::apply(
+    Func const& f) const {
+  RealType const x0 = static_cast<root_type>(*this);
+  return compose(f(make_fvar<RealType, K - 1>(x0)), f(make_fvar<LowType, Order>(static_cast<LowType>(x0))));
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+std::array<LowType, spvar<RealType, LowType, Order, K, Vars>::size>
+spvar<RealType, LowType, Order, K, Vars>::lowered() const {
+  std::array<LowType, size> retval;
+  for (size_t i = 0; i < high_size; ++i)
+    retval[i] = static_cast<LowType>(hi[i]);
+  std::copy(lo.cbegin(), lo.cend(), retval.begin() + high_size);
+  return retval;
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+std::ostream& operator<<(std::ostream& out, spvar<RealType, LowType, Order, K, Vars> const& cr) {
+  out << "split(" << K << ")(" << cr.hi.front();
+  for (size_t i = 1; i < cr.hi.size(); ++i)
+    out << ',' << cr.hi[i];
+  for (LowType const& x : cr.lo)
+    out << ',' << x;
+  return out << ')';
+}
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+struct make_spvar_impl {
+  template <size_t... Is, typename... RealTypes>
+  static std::array<spvar<RealType, LowType, Order, K, Vars>, Vars> make(mp11::index_sequence<Is...>,
+                                                                         RealTypes const&... ca) {
+    return {{spvar<RealType, LowType, Order, K, Vars>(static_cast<RealType>(ca), Is)...}};
+  }
+};
+
+}  // namespace detail
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars = 1>
+using autodiff_spvar = detail::spvar<RealType, LowType, Order, K, Vars>;
+
+// Independent variable of a function of one variable, whose derivatives of order < K are held in RealType and
+// the rest in LowType.
+template <typename RealType, typename LowType, size_t Order, size_t K>
+autodiff_spvar<RealType, LowType, Order, K> make_spvar(RealType const& ca) {
+  return autodiff_spvar<RealType, LowType, Order, K>(ca, 0);
+}
+
+// Independent variables of a function of sizeof...(RealTypes) variables, whose mixed partial derivatives of
+// total order < K are held in RealType and the rest in LowType, for use with std::get<>() or
+// mp11::tuple_apply() the same as the return value of make_ftuple().
+template <typename RealType, typename LowType, size_t Order, size_t K, typename... RealTypes>
+std::array<autodiff_spvar<RealType, LowType, Order, K, sizeof...(RealTypes)>, sizeof...(RealTypes)>
+make_sptuple(RealTypes const&... ca) {
+  return detail::make_spvar_impl<RealType, LowType, Order, K, sizeof...(RealTypes)>::make(
+      mp11::index_sequence_for<RealTypes...>{}, ca...);
+}
+
+}  // namespace autodiff_v1
+}  // namespace differentiation
+}  // namespace math
+}  // namespace boost
+
+namespace std {
+
+template <typename RealType, typename LowType, size_t Order, size_t K, size_t Vars>
+class numeric_limits<boost::math::differentiation::detail::spvar<RealType, LowType, Order, K, Vars>>
+    : public numeric_limits<RealType> {};
+
+}  // namespace std
+
+#endif  // BOOST_MATH_DIFFERENTIATION_AUTODIFF_SPLIT_PRECISION_HPP
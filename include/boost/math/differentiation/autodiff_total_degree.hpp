@@ -0,0 +1,459 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+// Notes:
+//  * tdvar<RealType,Vars,Degree> is a truncated Taylor polynomial in Vars variables that holds only the
+//    monomials of total degree <= Degree, in a flat std::array. Compare to autodiff_fvar<RealType,N,...,N>,
+//    which holds all (N+1)^Vars coefficients of the nested fvar tensor and multiplies all of them. E.g. for
+//    Vars=4 and Degree=3 that is 35 coefficients instead of 256.
+//  * Monomials are stored in graded order (by total degree, then by descending exponent of the first
+//    variable, etc.) The exponents of each monomial, and a list of all pairs of monomials whose product has
+//    total degree <= Degree grouped by their product, are calculated once per (Vars,Degree) by
+//    monomial_table, at compile time when C++14 constexpr is available and the table is not too large.
+//  * Multiplication and division are a single pass through that list. All other functions are evaluated by
+//    composing the univariate fvar<RealType,Degree> of the function at the constant term with *this.
+//  * Use make_tdtuple<RealType,Degree>(x, y, ...) to create the independent variables, and
+//    derivative(i, j, ...) to extract the mixed partial derivative d^(i+j+...)/(dx^i dy^j ...) for
+//    i+j+... <= Degree.
+
+#ifndef BOOST_MATH_DIFFERENTIATION_AUTODIFF_TOTAL_DEGREE_HPP
+#define BOOST_MATH_DIFFERENTIATION_AUTODIFF_TOTAL_DEGREE_HPP
+
+#include <boost/math/differentiation/autodiff.hpp>
+#include <boost/mp11/integer_sequence.hpp>
+
+#include "detail/autodiff_composed.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace boost {
+namespace math {
+namespace differentiation {
+inline namespace autodiff_v1 {
+namespace detail {
+
+template <typename RealType, size_t Vars, size_t Degree>
+class tdvar {
+  using table_type = monomial_table<Vars, Degree>;
+
+  std::array<RealType, table_type::size> v;
+
+ public:
+  using root_type = RealType;
+
+  tdvar() = default;
+
+  // Initialize independent variable number variable. Will throw std::out_of_range if Vars <= variable.
+  tdvar(root_type const& ca, size_t variable);
+
+  // Initialize a constant.
+  tdvar(root_type const& ca);
+
+  tdvar& operator+=(tdvar const&);
+
+  tdvar& operator+=(root_type const&);
+
+  tdvar& operator-=(tdvar const&);
+
+  tdvar& operator-=(root_type const&);
+
+  tdvar& operator*=(tdvar const&);
+
+  tdvar& operator*=(root_type const&);
+
+  tdvar& operator/=(tdvar const&);
+
+  tdvar& operator/=(root_type const&);
+
+  tdvar operator-() const;
+
+  tdvar const& operator+() const;
+
+  tdvar operator+(tdvar const&) const;
+
+  tdvar operator+(root_type const&) const;
+
+  tdvar operator-(tdvar const&) const;
+
+  tdvar operator-(root_type const&) const;
+
+  tdvar operator*(tdvar const&)const;
+
+  tdvar operator*(root_type const&)const;
+
+  tdvar operator/(tdvar const&) const;
+
+  tdvar operator/(root_type const&) const;
+
+  // Taylor coefficient of x0^orders0 * x1^orders1 * ...
+  // Will throw std::out_of_range if Degree < sum of orders.
+  template <typename... Orders>
+  root_type at(Orders... orders) const;
+
+  // Mixed partial derivative d^(orders0+orders1+...)/(dx0^orders0 dx1^orders1 ...)
+  // Will throw std::out_of_range if Degree < sum of orders.
+  template <typename... Orders>
+  root_type derivative(Orders... orders) const;
+
+  // Coefficients in graded order.
+  root_type const& operator[](size_t) const;
+
+  tdvar inverse() const;  // Multiplicative inverse.
+
+  tdvar& negate();  // Negate and return reference to *this.
+
+  static constexpr size_t size = table_type::size;  // Number of monomials of total degree <= Degree.
+
+  explicit operator root_type() const;
+
+  template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+  explicit operator T() const;
+
+  tdvar& set_root(root_type const&);
+
+  // Returns f(*this), given the Taylor coefficients f[0..Degree] of a univariate function about the constant
+  // term of *this, e.g. f = exp(make_fvar<RealType,Degree>(static_cast<RealType>(*this))).
+  tdvar compose(fvar<RealType, Degree> const& f) const;
+
+  // Returns f(*this), given a function object f of fvar<RealType,Degree>, by compose() with f at the
+  // constant term of *this.
+  template <typename Func>
+  tdvar apply(Func const& f) const;
+
+ private:
+  // Product with cr, assuming the constant term of cr is 0.
+  tdvar multiply_nilpotent(tdvar const& cr) const;
+
+  template <typename RealType2, size_t Vars2, size_t Degree2>
+  friend std::ostream& operator<<(std::ostream&, tdvar<RealType2, Vars2, Degree2> const&);
+};
+
+// Comparisons and functions of a tdvar are those of detail/autodiff_composed.hpp.
+template <typename RealType, size_t Vars, size_t Degree>
+struct is_composed<tdvar<RealType, Vars, Degree>> : std::true_type {};
+
+template <typename RealType, size_t Vars, size_t Degree>
+constexpr size_t tdvar<RealType, Vars, Degree>::size;
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>::tdvar(root_type const& ca, size_t variable) : tdvar(ca) {
+  // v.at() alone would accept the indices of the monomials of degree 2 that follow the Vars of degree 1.
+  if (Vars <= variable)
+    throw std::out_of_range("tdvar: variable must be less than Vars.");
+  if BOOST_AUTODIFF_IF_CONSTEXPR (0 < Degree)
+    v[1 + variable] = static_cast<root_type>(1);
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>::tdvar(root_type const& ca) {
+  v.front() = ca;
+  std::fill(v.begin() + 1, v.end(), static_cast<root_type>(0));
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>& tdvar<RealType, Vars, Degree>::operator+=(tdvar const& cr) {
+  for (size_t i = 0; i < size; ++i)
+    v[i] += cr.v[i];
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>& tdvar<RealType, Vars, Degree>::operator+=(root_type const& ca) {
+  v.front() += ca;
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>& tdvar<RealType, Vars, Degree>::operator-=(tdvar const& cr) {
+  for (size_t i = 0; i < size; ++i)
+    v[i] -= cr.v[i];
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>& tdvar<RealType, Vars, Degree>::operator-=(root_type const& ca) {
+  v.front() -= ca;
+  return *this;
+}
+
+// Product k only depends on the factors of monomials <= k, so it is calculated in place from the top down.
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>& tdvar<RealType, Vars, Degree>::operator*=(tdvar const& cr) {
+  if (&cr == this)
+    return *this = *this * cr;
+  table_type const& table = get_monomial_table<Vars, Degree>();
+  for (size_t k = size; k--;) {
+    RealType sum = v[k] * cr.v.front();
+    for (size_t p = table.product_begin[k] + 1; p < table.product_begin[k + 1]; ++p)
+      sum += v[table.lhs[p]] * cr.v[table.rhs[p]];
+    v[k] = sum;
+  }
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>& tdvar<RealType, Vars, Degree>::operator*=(root_type const& ca) {
+  for (RealType& x : v)
+    x *= ca;
+  return *this;
+}
+
+// Forward substitution: quotient k only depends on the quotients of monomials < k, so it is calculated in
+// place from the bottom up.
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>& tdvar<RealType, Vars, Degree>::operator/=(tdvar const& cr) {
+  if (&cr == this)
+    return *this = *this / cr;
+  table_type const& table = get_monomial_table<Vars, Degree>();
+  for (size_t k = 0; k < size; ++k) {
+    RealType sum = v[k];
+    for (size_t p = table.product_begin[k] + 1; p < table.product_begin[k + 1]; ++p)
+      sum -= v[table.lhs[p]] * cr.v[table.rhs[p]];
+    v[k] = sum / cr.v.front();
+  }
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>& tdvar<RealType, Vars, Degree>::operator/=(root_type const& ca) {
+  for (RealType& x : v)
+    x /= ca;
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::operator-() const {
+  tdvar retval(*this);
+  return retval.negate();
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> const& tdvar<RealType, Vars, Degree>::operator+() const {
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::operator+(tdvar const& cr) const {
+  tdvar retval(*this);
+  return retval += cr;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::operator+(root_type const& ca) const {
+  tdvar retval(*this);
+  return retval += ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> operator+(typename tdvar<RealType, Vars, Degree>::root_type const& ca,
+                                        tdvar<RealType, Vars, Degree> const& cr) {
+  return cr + ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::operator-(tdvar const& cr) const {
+  tdvar retval(*this);
+  return retval -= cr;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::operator-(root_type const& ca) const {
+  tdvar retval(*this);
+  return retval -= ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> operator-(typename tdvar<RealType, Vars, Degree>::root_type const& ca,
+                                        tdvar<RealType, Vars, Degree> const& cr) {
+  return -cr += ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::operator*(tdvar const& cr) const {
+  table_type const& table = get_monomial_table<Vars, Degree>();
+  tdvar retval;
+  for (size_t k = 0; k < size; ++k) {
+    RealType sum = v[k] * cr.v.front();
+    for (size_t p = table.product_begin[k] + 1; p < table.product_begin[k + 1]; ++p)
+      sum += v[table.lhs[p]] * cr.v[table.rhs[p]];
+    retval.v[k] = sum;
+  }
+  return retval;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::operator*(root_type const& ca) const {
+  tdvar retval(*this);
+  return retval *= ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> operator*(typename tdvar<RealType, Vars, Degree>::root_type const& ca,
+                                        tdvar<RealType, Vars, Degree> const& cr) {
+  return cr * ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::operator/(tdvar const& cr) const {
+  tdvar retval(*this);
+  return retval /= cr;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::operator/(root_type const& ca) const {
+  tdvar retval(*this);
+  return retval /= ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> operator/(typename tdvar<RealType, Vars, Degree>::root_type const& ca,
+                                        tdvar<RealType, Vars, Degree> const& cr) {
+  tdvar<RealType, Vars, Degree> retval(ca);
+  return retval /= cr;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+template <typename... Orders>
+RealType tdvar<RealType, Vars, Degree>::at(Orders... orders) const {
+  static_assert(sizeof...(Orders) == Vars, "Number of orders must match number of variables.");
+  size_t const exponents[Vars]{static_cast<size_t>(orders)...};
+  return v.at(table_type::index(exponents));
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+template <typename... Orders>
+RealType tdvar<RealType, Vars, Degree>::derivative(Orders... orders) const {
+  static_assert(sizeof...(Orders) == Vars, "Number of orders must match number of variables.");
+  size_t const exponents[Vars]{static_cast<size_t>(orders)...};
+  RealType retval = v.at(table_type::index(exponents));
+  for (size_t order : exponents)
+    retval *= factorial<RealType, Degree>(static_cast<unsigned>(order));
+  return retval;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+RealType const& tdvar<RealType, Vars, Degree>::operator[](size_t i) const {
+  return v[i];
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::inverse() const {
+  return static_cast<root_type>(1) / *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>& tdvar<RealType, Vars, Degree>::negate() {
+  for (RealType& x : v)
+    x = -x;
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>::operator root_type() const {
+  return v.front();
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+template <typename T, typename>
+tdvar<RealType, Vars, Degree>::operator T() const {
+  return static_cast<T>(v.front());
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree>& tdvar<RealType, Vars, Degree>::set_root(root_type const& root) {
+  v.front() = root;
+  return *this;
+}
+
+// Horner's method in h = *this - (constant term): f[Degree]*h^Degree + ... + f[1]*h + f[0].
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::compose(fvar<RealType, Degree> const& f) const {
+  tdvar h(*this);
+  h.v.front() = static_cast<root_type>(0);
+  tdvar retval(f[Degree]);
+  for (size_t i = Degree; i--;) {
+    retval = retval.multiply_nilpotent(h);
+    retval.v.front() = f[i];
+  }
+  return retval;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+template <typename Func>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::apply(Func const& f) const {
+  return compose(f(make_fvar<RealType, Degree>(static_cast<root_type>(*this))));
+}
+
+// Same as operator*() without the pairs (k,0).
+template <typename RealType, size_t Vars, size_t Degree>
+tdvar<RealType, Vars, Degree> tdvar<RealType, Vars, Degree>::multiply_nilpotent(tdvar const& cr) const {
+  table_type const& table = get_monomial_table<Vars, Degree>();
+  tdvar retval;
+  retval.v.front() = static_cast<root_type>(0);
+  for (size_t k = 1; k < size; ++k) {
+    RealType sum = static_cast<root_type>(0);
+    for (size_t p = table.product_begin[k] + 1; p < table.product_begin[k + 1]; ++p)
+      sum += v[table.lhs[p]] * cr.v[table.rhs[p]];
+    retval.v[k] = sum;
+  }
+  return retval;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+std::ostream& operator<<(std::ostream& out, tdvar<RealType, Vars, Degree> const& cr) {
+  out << "vars(" << Vars << ")(" << cr.v.front();
+  for (size_t i = 1; i < cr.size; ++i)
+    out << ',' << cr.v[i];
+  return out << ')';
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+struct make_tdvar_impl {
+  template <size_t... Is, typename... RealTypes>
+  static std::array<tdvar<RealType, Vars, Degree>, Vars> make(mp11::index_sequence<Is...>,
+                                                             RealTypes const&... ca) {
+    return {{tdvar<RealType, Vars, Degree>(static_cast<RealType>(ca), Is)...}};
+  }
+};
+
+}  // namespace detail
+
+template <typename RealType, size_t Vars, size_t Degree>
+using autodiff_tdvar = detail::tdvar<RealType, Vars, Degree>;
+
+// Independent variable number variable, 0 <= variable < Vars, of a function of Vars variables.
+template <typename RealType, size_t Vars, size_t Degree>
+autodiff_tdvar<RealType, Vars, Degree> make_tdvar(RealType const& ca, size_t variable) {
+  return autodiff_tdvar<RealType, Vars, Degree>(ca, variable);
+}
+
+// Independent variables of a function of sizeof...(RealTypes) variables, for use with std::get<>() or
+// mp11::tuple_apply() the same as the return value of make_ftuple().
+template <typename RealType, size_t Degree, typename... RealTypes>
+std::array<autodiff_tdvar<RealType, sizeof...(RealTypes), Degree>, sizeof...(RealTypes)> make_tdtuple(
+    RealTypes const&... ca) {
+  return detail::make_tdvar_impl<RealType, sizeof...(RealTypes), Degree>::make(
+      mp11::index_sequence_for<RealTypes...>{}, ca...);
+}
+
+}  // namespace autodiff_v1
+}  // namespace differentiation
+}  // namespace math
+}  // namespace boost
+
+namespace std {
+
+template <typename RealType, size_t Vars, size_t Degree>
+class numeric_limits<boost::math::differentiation::detail::tdvar<RealType, Vars, Degree>>
+    : public numeric_limits<RealType> {};
+
+}  // namespace std
+
+#endif  // BOOST_MATH_DIFFERENTIATION_AUTODIFF_TOTAL_DEGREE_HPP
@@ -0,0 +1,333 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+// Notes:
+//  * Comparisons and functions shared by spvar and tdvar, whose functions are evaluated by composing the
+//    univariate fvar of the same function at the constant term with *this. Each such type Var specializes
+//    is_composed<Var>, and provides root_type, construction from and explicit conversion to root_type,
+//    set_root(), the arithmetic operators, and Var::apply(f), which returns f(*this) given f of those fvar.
+//  * monomial_table<Vars,Degree> lists the monomials of total degree <= Degree in graded order, and the
+//    pairs of monomials whose product is each of them. Both tdvar and spvar multiply through it.
+
+#if !defined(BOOST_MATH_DIFFERENTIATION_AUTODIFF_SPLIT_PRECISION_HPP) && \
+    !defined(BOOST_MATH_DIFFERENTIATION_AUTODIFF_TOTAL_DEGREE_HPP)
+#error "Do not #include this file directly. This should only be #included by the autodiff_*.hpp headers."
+#endif
+
+#ifndef BOOST_MATH_DIFFERENTIATION_DETAIL_AUTODIFF_COMPOSED_HPP
+#define BOOST_MATH_DIFFERENTIATION_DETAIL_AUTODIFF_COMPOSED_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace boost {
+namespace math {
+namespace differentiation {
+inline namespace autodiff_v1 {
+namespace detail {
+
+template <typename T>
+struct is_composed : std::false_type {};
+
+template <typename Var, typename T = Var>
+using enable_if_composed = typename std::enable_if<is_composed<Var>::value, T>::type;
+
+constexpr size_t binomial_coefficient(size_t n, size_t k) {
+  return k == 0 ? 1 : binomial_coefficient(n - 1, k - 1) * n / k;
+}
+
+// Exponents of all monomials in Vars variables of total degree <= Degree, and for each monomial k the list of
+// pairs of monomials (lhs[p],rhs[p]) for p in [product_begin[k],product_begin[k+1]) whose product is k. The
+// first pair of each list is (k,0).
+template <size_t Vars, size_t Degree>
+struct monomial_table {
+  static_assert(0 < Vars, "A monomial_table must have at least one variable.");
+
+  static constexpr size_t size = binomial_coefficient(Vars + Degree, Vars);
+
+  static constexpr size_t products = binomial_coefficient(2 * Vars + Degree, 2 * Vars);
+
+  size_t exponents[size][Vars] = {};
+
+  size_t degree_begin[Degree + 2] = {};  // Index of the first monomial of each total degree.
+
+  size_t product_begin[size + 1] = {};
+
+  size_t lhs[products] = {};
+
+  size_t rhs[products] = {};
+
+  BOOST_CXX14_CONSTEXPR monomial_table();
+
+  // Index of the monomial with the given exponents. Returns a value >= size if their sum exceeds Degree.
+  static BOOST_CXX14_CONSTEXPR size_t index(size_t const (&exponents)[Vars]);
+};
+
+template <size_t Vars, size_t Degree>
+BOOST_CXX14_CONSTEXPR monomial_table<Vars, Degree>::monomial_table() {
+  size_t i = 0;
+  for (size_t d = 0; d <= Degree; ++d) {
+    degree_begin[d] = i;
+    size_t e[Vars] = {};
+    e[0] = d;
+    for (;;) {
+      for (size_t v = 0; v < Vars; ++v)
+        exponents[i][v] = e[v];
+      ++i;
+      // Next exponents of total degree d in descending lexicographic order.
+      size_t q = Vars - 1;
+      while (0 < q && e[q - 1] == 0)
+        --q;
+      if (q == 0)
+        break;
+      size_t tail = 1;
+      for (size_t v = q; v < Vars; ++v) {
+        tail += e[v];
+        e[v] = 0;
+      }
+      --e[q - 1];
+      e[q] = tail;
+    }
+  }
+  degree_begin[Degree + 1] = size;
+  // Count the pairs for each product, then fill them in. rhs is the outer loop so that (k,0) comes first.
+  for (size_t pass = 0; pass < 2; ++pass) {
+    size_t next[size + 1] = {};
+    for (size_t k = 0; k <= size; ++k)
+      next[k] = product_begin[k];
+    for (size_t dj = 0; dj <= Degree; ++dj) {
+      for (size_t j = degree_begin[dj]; j < degree_begin[dj + 1]; ++j) {
+        for (size_t l = 0; l < degree_begin[Degree - dj + 1]; ++l) {
+          size_t e[Vars] = {};
+          for (size_t v = 0; v < Vars; ++v)
+            e[v] = exponents[l][v] + exponents[j][v];
+          size_t const k = index(e);
+          if (pass == 0) {
+            ++product_begin[k + 1];
+          } else {
+            lhs[next[k]] = l;
+            rhs[next[k]] = j;
+            ++next[k];
+          }
+        }
+      }
+    }
+    if (pass == 0)
+      for (size_t k = 0; k < size; ++k)
+        product_begin[k + 1] += product_begin[k];
+  }
+}
+
+template <size_t Vars, size_t Degree>
+BOOST_CXX14_CONSTEXPR size_t monomial_table<Vars, Degree>::index(size_t const (&exponents)[Vars]) {
+  size_t d = 0;
+  for (size_t v = 0; v < Vars; ++v)
+    d += exponents[v];
+  if (d == 0)
+    return 0;
+  // Number of monomials of total degree < d, plus the number of monomials of degree d that precede it.
+  size_t retval = binomial_coefficient(d - 1 + Vars, Vars);
+  for (size_t v = 0, remainder = d; v + 1 < Vars; remainder -= exponents[v++])
+    if (exponents[v] < remainder)
+      retval += binomial_coefficient(remainder - exponents[v] - 1 + Vars - v - 1, Vars - v - 1);
+  return retval;
+}
+
+// Larger tables are calculated at run time, on first use, to stay within the compilers' constexpr limits.
+template <size_t Vars, size_t Degree>
+using has_constexpr_monomial_table = std::integral_constant<bool,
+#ifndef BOOST_NO_CXX14_CONSTEXPR
+                                                            monomial_table<Vars, Degree>::products <= 16384
+#else
+                                                            false
+#endif
+                                                            >;
+
+template <size_t Vars, size_t Degree>
+monomial_table<Vars, Degree> const& get_monomial_table(std::true_type) {
+  static BOOST_CXX14_CONSTEXPR monomial_table<Vars, Degree> const table{};
+  return table;
+}
+
+template <size_t Vars, size_t Degree>
+monomial_table<Vars, Degree> const& get_monomial_table(std::false_type) {
+  static monomial_table<Vars, Degree> const table{};
+  return table;
+}
+
+template <size_t Vars, size_t Degree>
+monomial_table<Vars, Degree> const& get_monomial_table() {
+  return get_monomial_table<Vars, Degree>(has_constexpr_monomial_table<Vars, Degree>{});
+}
+
+// For all comparison overloads, only the constant term is compared.
+
+#define BOOST_AUTODIFF_COMPOSED_COMPARISON(op)                                                        \
+  template <typename Var>                                                                             \
+  enable_if_composed<Var, bool> operator op(Var const& cr1, Var const& cr2) {                         \
+    using root_type = typename Var::root_type;                                                        \
+    return static_cast<root_type>(cr1) op static_cast<root_type>(cr2);                                \
+  }                                                                                                   \
+  template <typename Var>                                                                             \
+  enable_if_composed<Var, bool> operator op(Var const& cr, typename Var::root_type const& ca) {       \
+    return static_cast<typename Var::root_type>(cr) op ca;                                            \
+  }                                                                                                   \
+  template <typename Var>                                                                             \
+  enable_if_composed<Var, bool> operator op(typename Var::root_type const& ca, Var const& cr) {       \
+    return ca op static_cast<typename Var::root_type>(cr);                                            \
+  }
+
+BOOST_AUTODIFF_COMPOSED_COMPARISON(==)
+BOOST_AUTODIFF_COMPOSED_COMPARISON(!=)
+BOOST_AUTODIFF_COMPOSED_COMPARISON(<=)
+BOOST_AUTODIFF_COMPOSED_COMPARISON(>=)
+BOOST_AUTODIFF_COMPOSED_COMPARISON(<)
+BOOST_AUTODIFF_COMPOSED_COMPARISON(>)
+
+#undef BOOST_AUTODIFF_COMPOSED_COMPARISON
+
+// Each function is passed to apply() as a function object, which is called with each fvar of the type.
+
+#define BOOST_AUTODIFF_COMPOSED_FUNCTION(name)                  \
+  struct composed_##name {                                      \
+    template <typename Fvar>                                    \
+    Fvar operator()(Fvar const& x) const {                      \
+      return name(x);                                           \
+    }                                                           \
+  };                                                            \
+  template <typename Var>                                       \
+  enable_if_composed<Var> name(Var const& cr) {                 \
+    return cr.apply(composed_##name{});                         \
+  }
+
+BOOST_AUTODIFF_COMPOSED_FUNCTION(acos)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(acosh)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(asin)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(asinh)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(atan)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(atanh)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(cos)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(cosh)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(digamma)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(erf)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(erfc)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(exp)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(lambert_w0)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(lgamma)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(log)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(sin)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(sinc)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(sinh)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(sqrt)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(tan)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(tanh)
+BOOST_AUTODIFF_COMPOSED_FUNCTION(tgamma)
+
+#undef BOOST_AUTODIFF_COMPOSED_FUNCTION
+
+// pow(x, y) as a function of x, for y of the root_type of each fvar.
+template <typename RealType>
+struct composed_pow_base {
+  RealType const& y;
+
+  template <typename Fvar>
+  Fvar operator()(Fvar const& x) const {
+    return pow(x, static_cast<typename Fvar::root_type>(y));
+  }
+};
+
+// pow(x, y) as a function of y, for x of the root_type of each fvar.
+template <typename RealType>
+struct composed_pow_exponent {
+  RealType const& x;
+
+  template <typename Fvar>
+  Fvar operator()(Fvar const& y) const {
+    return pow(static_cast<typename Fvar::root_type>(x), y);
+  }
+};
+
+template <typename Var>
+enable_if_composed<Var> fabs(Var const& cr) {
+  typename Var::root_type const zero(0);
+  return cr < zero ? -cr
+                   : cr == zero ? Var(zero)  // Canonical fabs'(0) = 0.
+                                : cr;        // Propagate NaN.
+}
+
+template <typename Var>
+enable_if_composed<Var> abs(Var const& cr) {
+  return fabs(cr);
+}
+
+template <typename Var>
+enable_if_composed<Var> ceil(Var const& cr) {
+  using std::ceil;
+  return Var(ceil(static_cast<typename Var::root_type>(cr)));
+}
+
+template <typename Var>
+enable_if_composed<Var> floor(Var const& cr) {
+  using std::floor;
+  return Var(floor(static_cast<typename Var::root_type>(cr)));
+}
+
+template <typename Var>
+enable_if_composed<Var> round(Var const& cr) {
+  using boost::math::round;
+  return Var(round(static_cast<typename Var::root_type>(cr)));
+}
+
+template <typename Var>
+enable_if_composed<Var> trunc(Var const& cr) {
+  using boost::math::trunc;
+  return Var(trunc(static_cast<typename Var::root_type>(cr)));
+}
+
+template <typename Var>
+enable_if_composed<Var> pow(Var const& x, typename Var::root_type const& y) {
+  return x.apply(composed_pow_base<typename Var::root_type>{y});
+}
+
+template <typename Var>
+enable_if_composed<Var> pow(typename Var::root_type const& x, Var const& y) {
+  return y.apply(composed_pow_exponent<typename Var::root_type>{x});
+}
+
+template <typename Var>
+enable_if_composed<Var> pow(Var const& x, Var const& y) {
+  return exp(y * log(x));
+}
+
+// atan(a/b) or -atan(b/a), whichever quotient is bounded, differs from atan2(a,b) by a constant.
+template <typename Var>
+enable_if_composed<Var> atan2(Var const& a, Var const& b) {
+  using std::atan2;
+  using std::fabs;
+  using root_type = typename Var::root_type;
+  root_type const a0 = static_cast<root_type>(a);
+  root_type const b0 = static_cast<root_type>(b);
+  Var retval = fabs(a0) <= fabs(b0) ? atan(a / b) : -atan(b / a);
+  return retval.set_root(atan2(a0, b0));
+}
+
+template <typename Var>
+enable_if_composed<Var> atan2(Var const& a, typename Var::root_type const& cb) {
+  return atan2(a, Var(cb));
+}
+
+template <typename Var>
+enable_if_composed<Var> atan2(typename Var::root_type const& ca, Var const& b) {
+  return atan2(Var(ca), b);
+}
+
+}  // namespace detail
+}  // namespace autodiff_v1
+}  // namespace differentiation
+}  // namespace math
+}  // namespace boost
+
+#endif  // BOOST_MATH_DIFFERENTIATION_DETAIL_AUTODIFF_COMPOSED_HPP
@@ -0,0 +1,1008 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+// Notes:
+//  * Truncated power series product and quotient for fvar<RealType,Order> of high Order, where RealType is a
+//    floating point type rather than a nested fvar. Products use a Karatsuba short product for
+//    Boost.Multiprecision types from BOOST_AUTODIFF_KARATSUBA_THRESHOLD coefficients, and an FFT for double
+//    from BOOST_AUTODIFF_FFT_THRESHOLD. Quotients use a block forward substitution on these products.
+//  * sqrt, log, exp and the inverse use Newton iterations on these products, which double the number of
+//    correct coefficients at each step.
+//  * The buffers of these kernels are taken from a workspace kept per thread, which allocates only when a
+//    kernel needs more than any before it at the same depth of nesting.
+//  * Define BOOST_AUTODIFF_NO_FAST_MULTIPLY to disable these kernels altogether.
+
+#ifndef BOOST_MATH_DIFFERENTIATION_AUTODIFF_HPP
+#error "Do not #include this file directly. This should only be #included by autodiff.hpp."
+#endif
+
+#ifndef BOOST_MATH_DIFFERENTIATION_DETAIL_AUTODIFF_SERIES_HPP
+#define BOOST_MATH_DIFFERENTIATION_DETAIL_AUTODIFF_SERIES_HPP
+
+#include <boost/math/constants/constants.hpp>
+#include <boost/multiprecision/number.hpp>
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifndef BOOST_AUTODIFF_KARATSUBA_THRESHOLD
+#define BOOST_AUTODIFF_KARATSUBA_THRESHOLD 64
+#endif
+
+#ifndef BOOST_AUTODIFF_FFT_THRESHOLD
+#define BOOST_AUTODIFF_FFT_THRESHOLD 4096
+#endif
+
+#ifndef BOOST_AUTODIFF_COMPOSE_THRESHOLD
+#define BOOST_AUTODIFF_COMPOSE_THRESHOLD 24
+#endif
+
+namespace boost {
+namespace math {
+namespace differentiation {
+inline namespace autodiff_v1 {
+namespace detail {
+
+// True with BOOST_AUTODIFF_FAST_MATH, under which the terms of a sum that are 0 are not skipped, as the other
+// factor is assumed finite. See autodiff.hpp.
+struct fast_math : std::integral_constant<bool,
+#ifdef BOOST_AUTODIFF_FAST_MATH
+                                          true
+#else
+                                          false
+#endif
+                                          > {
+};
+
+namespace series {
+
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+// The buffers of the workspaces on this thread, one for each level of nesting, which keep their capacity
+// between calls. Each is a std::vector of its own, so that a nested workspace that grows its buffer does not
+// move those of the workspaces that enclose it.
+template <typename T>
+struct workspace_stack {
+  std::vector<std::vector<T>> buffers;
+  size_t depth = 0;
+};
+
+template <typename T>
+workspace_stack<T>& thread_workspaces() {
+  static thread_local workspace_stack<T> stack;
+  return stack;
+}
+#endif
+
+// Storage of n elements of T for the lifetime of a kernel, in place of a std::array<T, N>, which at the
+// lengths of the fast kernels would overflow the stack. It allocates only when it needs more than any
+// workspace before it at the same level of nesting on this thread, or on each construction without
+// thread_local. The elements are not reset, and hold what a previous workspace left in them.
+template <typename T>
+class workspace {
+ public:
+  explicit workspace(size_t n) {
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+    workspace_stack<T>& stack = thread_workspaces<T>();
+    if (stack.buffers.size() == stack.depth)
+      stack.buffers.emplace_back();
+    std::vector<T>& buffer = stack.buffers[stack.depth];
+    if (buffer.size() < n)
+      buffer.resize(n);
+    data_ = buffer.data();
+    ++stack.depth;
+#else
+    buffer_.resize(n);
+    data_ = buffer_.data();
+#endif
+  }
+
+  workspace(workspace const&) = delete;
+  workspace& operator=(workspace const&) = delete;
+
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+  ~workspace() { --thread_workspaces<T>().depth; }
+#endif
+
+  T* data() { return data_; }
+  T const* data() const { return data_; }
+  T& operator[](size_t i) { return data_[i]; }
+  T const& operator[](size_t i) const { return data_[i]; }
+
+ private:
+  T* data_;
+#ifdef BOOST_NO_CXX11_THREAD_LOCAL
+  std::vector<T> buffer_;
+#endif
+};
+
+// Length from which the fast product is used, or 0 if never. Karatsuba does not pay for itself with the
+// built-in floating point types at any length of practical use, and neither does the FFT below its threshold
+// against the SIMD kernels of autodiff_simd.hpp. The FFT is only as accurate as double, so long double is
+// excluded.
+template <typename RealType>
+struct fast_multiply_threshold
+    : std::integral_constant<size_t,
+                             std::is_same<RealType, double>::value ? BOOST_AUTODIFF_FFT_THRESHOLD
+                             : boost::multiprecision::is_number<RealType>::value
+                                 ? BOOST_AUTODIFF_KARATSUBA_THRESHOLD
+                                 : 0> {};
+
+// True when fvar<RealType,Order> op fvar<RealType2,Order2> is evaluated by the kernels below.
+template <typename RealType, size_t Order, typename RealType2, size_t Order2>
+struct has_fast_multiply
+    : std::integral_constant<bool,
+#ifdef BOOST_AUTODIFF_NO_FAST_MULTIPLY
+                             false
+#else
+                             Order == Order2 && std::is_same<RealType, RealType2>::value &&
+                                 fast_multiply_threshold<RealType>::value != 0 &&
+                                 fast_multiply_threshold<RealType>::value <= Order + 1
+#endif
+                             > {
+};
+
+// Below this length the quotient is solved for by forward substitution.
+template <typename RealType>
+struct fast_divide_threshold
+    : std::integral_constant<size_t, 4 * fast_multiply_threshold<RealType>::value> {};
+
+// Below this length the inverse is computed as a quotient rather than by Newton iteration. Division by
+// Newton iteration, as a product with the inverse, is slower than the quotient at all lengths measured.
+template <typename RealType>
+struct newton_inverse_threshold
+    : std::integral_constant<size_t, 4 * fast_divide_threshold<RealType>::value> {};
+
+// Below this length the schoolbook algorithms are used within the recursions.
+constexpr size_t karatsuba_leaf =
+    BOOST_AUTODIFF_KARATSUBA_THRESHOLD / 2 < 8 ? 8 : BOOST_AUTODIFF_KARATSUBA_THRESHOLD / 2;
+
+constexpr size_t karatsuba_workspace(size_t n) {
+  return n < karatsuba_leaf ? 0 : 4 * (n - n / 2) - 1 + karatsuba_workspace(n - n / 2);
+}
+
+constexpr size_t short_product_workspace(size_t n) {
+  return n < karatsuba_leaf ? 0
+                            : (2 * (n - n / 2) - 1 + karatsuba_workspace(n - n / 2) <
+                                       n / 2 + short_product_workspace(n / 2)
+                                   ? n / 2 + short_product_workspace(n / 2)
+                                   : 2 * (n - n / 2) - 1 + karatsuba_workspace(n - n / 2));
+}
+
+template <typename RealType>
+RealType dot(RealType const* a, RealType const* b, size_t k) {
+  RealType retval = a[0] * b[k];
+  for (size_t i = 1; i <= k; ++i)
+    retval += a[i] * b[k - i];
+  return retval;
+}
+
+// r[0..2n-1) = a[0..n) * b[0..n). w is workspace of karatsuba_workspace(n) elements.
+template <typename RealType>
+void karatsuba(RealType* r, RealType const* a, RealType const* b, size_t n, RealType* w) {
+  if (n < karatsuba_leaf) {
+    for (size_t k = 0; k < 2 * n - 1; ++k)
+      r[k] = 0;
+    for (size_t i = 0; i < n; ++i)
+      for (size_t j = 0; j < n; ++j)
+        r[i + j] += a[i] * b[j];
+    return;
+  }
+  size_t const m = n / 2;
+  size_t const h = n - m;
+  karatsuba(r, a, b, m, w);
+  r[2 * m - 1] = 0;
+  karatsuba(r + 2 * m, a + m, b + m, h, w);
+  RealType* const sa = w;
+  RealType* const sb = w + h;
+  RealType* const z = w + 2 * h;
+  for (size_t i = 0; i < h; ++i) {
+    sa[i] = a[m + i];
+    sb[i] = b[m + i];
+  }
+  for (size_t i = 0; i < m; ++i) {
+    sa[i] += a[i];
+    sb[i] += b[i];
+  }
+  karatsuba(z, sa, sb, h, z + 2 * h - 1);
+  for (size_t i = 0; i < 2 * m - 1; ++i)
+    z[i] -= r[i];
+  for (size_t i = 0; i < 2 * h - 1; ++i)
+    z[i] -= r[2 * m + i];
+  for (size_t i = 0; i < 2 * h - 1; ++i)
+    r[m + i] += z[i];
+}
+
+// r[0..n) = a[0..n) * b[0..n) truncated to n coefficients. w is workspace of short_product_workspace(n).
+template <typename RealType>
+void short_product(RealType* r, RealType const* a, RealType const* b, size_t n, RealType* w) {
+  if (n < karatsuba_leaf) {
+    for (size_t k = 0; k < n; ++k)
+      r[k] = dot(a, b, k);
+    return;
+  }
+  size_t const k = n - n / 2;
+  size_t const l = n / 2;
+  karatsuba(w, a, b, k, w + 2 * k - 1);
+  for (size_t i = 0; i < 2 * k - 1; ++i)
+    r[i] = w[i];
+  if (2 * k - 1 < n)
+    r[n - 1] = 0;
+  short_product(w, a, b + k, l, w + l);
+  for (size_t i = 0; i < l; ++i)
+    r[k + i] += w[i];
+  short_product(w, a + k, b, l, w + l);
+  for (size_t i = 0; i < l; ++i)
+    r[k + i] += w[i];
+}
+
+constexpr size_t fft_length(size_t n, size_t length = 1) {
+  return length < 2 * n - 1 ? fft_length(n, 2 * length) : length;
+}
+
+// Roots of unity exp(-2*pi*i*k/N) for k in [0,N/2), each computed directly rather than by recurrence.
+template <size_t N>
+struct fft_roots {
+  std::array<std::complex<double>, N / 2> w;
+
+  fft_roots() {
+    for (size_t k = 0; k < N / 2; ++k) {
+      double const angle = -2 * constants::pi<double>() * static_cast<double>(k) / static_cast<double>(N);
+      w[k] = std::complex<double>(std::cos(angle), std::sin(angle));
+    }
+  }
+};
+
+template <size_t N>
+void fft(std::complex<double>* x, bool inverse) {
+  static fft_roots<N> const roots;
+  for (size_t i = 1, j = 0; i < N; ++i) {
+    size_t bit = N >> 1;
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+    if (i < j)
+      std::swap(x[i], x[j]);
+  }
+  for (size_t length = 2; length <= N; length <<= 1) {
+    size_t const half = length / 2;
+    size_t const stride = N / length;
+    for (size_t i = 0; i < N; i += length)
+      for (size_t k = 0; k < half; ++k) {
+        std::complex<double> const& wk = roots.w[k * stride];
+        std::complex<double> const t = x[i + k + half] * (inverse ? std::conj(wk) : wk);
+        x[i + k + half] = x[i + k] - t;
+        x[i + k] += t;
+      }
+  }
+}
+
+// Exponent s such that 2^s*b has about the 2-norm of a.
+inline int fft_shift(double const* a, double const* b, size_t n, double& norm_a, double& norm_b) {
+  norm_a = 0;
+  norm_b = 0;
+  for (size_t i = 0; i < n; ++i) {
+    norm_a += a[i] * a[i];
+    norm_b += b[i] * b[i];
+  }
+  norm_a = std::sqrt(norm_a);
+  norm_b = std::sqrt(norm_b);
+  int ea = 0;
+  int eb = 0;
+  std::frexp(norm_a, &ea);
+  std::frexp(norm_b, &eb);
+  return norm_a == 0 || norm_b == 0 ? 0 : ea - eb;
+}
+
+// r[0..n) = a[0..n) * b[0..n) truncated to n coefficients, by one forward and one inverse FFT of length
+// N = fft_length(n) of the packed sequence a + i*2^s*b. Unpacking mixes the rounding errors of a and b, so b
+// is first scaled by 2^s to the 2-norm of a.
+template <size_t N>
+void fft_product(double* r, double const* a, double const* b, size_t n) {
+  double norm_a;
+  double norm_b;
+  int const s = fft_shift(a, b, n, norm_a, norm_b);
+  workspace<std::complex<double>> x(N);
+  for (size_t i = 0; i < n; ++i)
+    x[i] = std::complex<double>(a[i], std::ldexp(b[i], s));
+  for (size_t i = n; i < N; ++i)
+    x[i] = 0;
+  fft<N>(x.data(), false);
+  std::complex<double> const quarter_i(0, -0.25);
+  for (size_t k = 0; k <= N / 2; ++k) {
+    size_t const j = (N - k) & (N - 1);
+    std::complex<double> const zk = x[k];
+    std::complex<double> const zj = std::conj(x[j]);
+    x[k] = (zk + zj) * (zk - zj) * quarter_i;
+    x[j] = std::conj(x[k]);
+  }
+  fft<N>(x.data(), true);
+  for (size_t i = 0; i < n; ++i)
+    r[i] = std::ldexp(x[i].real() / static_cast<double>(N), -s);
+}
+
+// log2 of |x|, or -infinity for 0.
+template <typename RealType>
+double log2_abs(RealType const& x) {
+  using std::fabs;
+  using std::frexp;
+  if (x == 0)
+    return -std::numeric_limits<double>::infinity();
+  int exponent;
+  RealType const mantissa = frexp(fabs(x), &exponent);
+  return exponent + std::log2(static_cast<double>(mantissa));
+}
+
+// Rate of decay of the coefficients of x[0..n), as log2 of the ratio of consecutive coefficients, estimated
+// from the largest coefficients of the first and last eighth of its nonzero coefficients. 0 if undefined.
+template <typename RealType>
+double decay_rate(RealType const* x, size_t n) {
+  size_t lo = 0;
+  size_t hi = n;
+  while (lo < n && x[lo] == 0)
+    ++lo;
+  while (lo < hi && x[hi - 1] == 0)
+    --hi;
+  if (hi < lo + 2)
+    return 0;
+  size_t const width = (hi - lo) / 8 < 1 ? 1 : (hi - lo) / 8;
+  double first = -std::numeric_limits<double>::infinity();
+  double last = -std::numeric_limits<double>::infinity();
+  for (size_t i = 0; i < width; ++i) {
+    first = (std::max)(first, log2_abs(x[lo + i]));
+    last = (std::max)(last, log2_abs(x[hi - width + i]));
+  }
+  return (first - last) / static_cast<double>(hi - width - lo);
+}
+
+template <typename RealType>
+RealType max_abs(RealType const* a, size_t n) {
+  using std::fabs;
+  RealType retval = 0;
+  for (size_t i = 0; i < n; ++i)
+    if (retval < fabs(a[i]))
+      retval = fabs(a[i]);
+  return retval;
+}
+
+// Error bounds of the fast products, in units of epsilon, are n*max|a|*max|b| for Karatsuba and
+// log2(N)*(|a|+2^s*|b|)^2/2^s in the 2-norm for the FFT. Both exceed the largest errors observed with random
+// coefficients of balanced magnitude by a factor of 3 or more.
+template <size_t N, typename RealType>
+RealType fast_product_bound(std::false_type, RealType const* a, RealType const* b, size_t n) {
+  return static_cast<RealType>(n) * max_abs(a, n) * max_abs(b, n);
+}
+
+template <size_t N>
+double fast_product_bound(std::true_type, double const* a, double const* b, size_t n) {
+  double norm_a;
+  double norm_b;
+  int const s = fft_shift(a, b, n, norm_a, norm_b);
+  double log2_length = 0;
+  for (size_t length = 1; length < fft_length(N); length <<= 1)
+    ++log2_length;
+  double const norm = norm_a + std::ldexp(norm_b, s);
+  return std::ldexp(log2_length * norm * norm, -s);
+}
+
+template <size_t N, typename RealType>
+void fast_product(std::false_type, RealType* r, RealType const* a, RealType const* b, size_t n) {
+  workspace<RealType> w(short_product_workspace(N));
+  short_product(r, a, b, n, w.data());
+}
+
+template <size_t N>
+void fast_product(std::true_type, double* r, double const* a, double const* b, size_t n) {
+  fft_product<fft_length(N)>(r, a, b, n);
+}
+
+// Operands of the fast product, scaled by rho^k = 2^(rate*k) and normalized by powers of 2, and which of the
+// coefficients of their product it computes accurately enough.
+template <size_t N, typename RealType>
+struct balanced_operands {
+  workspace<RealType> scale;
+  workspace<RealType> a;
+  workspace<RealType> b;
+  int ea;
+  int eb;
+  bool is_scaled;
+  // Magnitudes (|a|*|b|)[k] of the terms of the coefficients of the product, and the least of them whose
+  // coefficient is accepted.
+  workspace<double> magnitude;
+  double tolerance;
+  size_t rejected;
+
+  balanced_operands() : scale(N), a(N), b(N), magnitude(N) {}
+
+  // Returns the number of coefficients from lo that are rejected.
+  size_t balance(double rate, RealType const* x, RealType const* y, size_t n, size_t lo) {
+    using std::fabs;
+    using std::frexp;
+    using std::ldexp;
+    using std::pow;
+    is_scaled = 1 <= std::fabs(rate) * static_cast<double>(n);
+    if (is_scaled) {
+      // rho^k = rho^(16*(k/16)) * rho^(k%16), so that each factor is within a few ulps.
+      RealType const rho = pow(static_cast<RealType>(2), static_cast<RealType>(rate));
+      std::array<RealType, 16> low;
+      for (size_t i = 0; i < 16 && i < n; ++i)
+        low[i] = pow(rho, static_cast<RealType>(i));
+      for (size_t i = 0; i < n; i += 16) {
+        RealType const high = pow(rho, static_cast<RealType>(i));
+        for (size_t j = i; j < i + 16 && j < n; ++j)
+          scale[j] = high * low[j - i];
+      }
+      for (size_t i = 0; i < n; ++i) {
+        a[i] = x[i] * scale[i];
+        b[i] = y[i] * scale[i];
+      }
+    } else
+      for (size_t i = 0; i < n; ++i) {
+        a[i] = x[i];
+        b[i] = y[i];
+      }
+    // Normalize each operand by a power of 2 so that the product neither overflows nor underflows.
+    frexp(max_abs(a.data(), n), &ea);
+    frexp(max_abs(b.data(), n), &eb);
+    for (size_t i = 0; i < n; ++i) {
+      a[i] = ldexp(a[i], -ea);
+      b[i] = ldexp(b[i], -eb);
+    }
+    // Accept the coefficients whose error bound is within 16*n*epsilon*(|a|*|b|)[k], a small multiple of
+    // the bound for the direct inner product. (|a|*|b|)[k] need only be rough, so it is computed in double by
+    // the FFT.
+    tolerance = static_cast<double>(
+        fast_product_bound<N>(std::is_same<RealType, double>{}, a.data(), b.data(), n) / (16 * n));
+    workspace<double> abs_a(N);
+    workspace<double> abs_b(N);
+    for (size_t i = 0; i < n; ++i) {
+      abs_a[i] = std::fabs(static_cast<double>(a[i]));
+      abs_b[i] = std::fabs(static_cast<double>(b[i]));
+    }
+    fft_product<fft_length(N)>(magnitude.data(), abs_a.data(), abs_b.data(), n);
+    rejected = 0;
+    if (tolerance < (std::numeric_limits<double>::max)())
+      for (size_t k = lo; k < n; ++k)
+        rejected += magnitude[k] < tolerance;
+    else
+      rejected = n - lo;
+    return rejected;
+  }
+};
+
+// r[lo..n) = a[0..n) * b[0..n) as truncated power series, n <= N, and r[0..lo) is unspecified. Newton
+// iterations need only the coefficients from lo, below which the product cancels to 0, and would otherwise
+// have all of those recomputed. r must not alias a or b.
+// The operands are scaled by rho^k, so that the terms of the coefficients of their product are of balanced
+// magnitude, and most of those are well above the error bound of the fast product. For two geometric
+// sequences, that is the slower of their rates of decay. If an operand is truncated, as in the Newton
+// iterations, the faster one can be better, so both are tried. Coefficients not computed accurately enough
+// are recomputed by the direct inner product. If there are many of those, the operands could not be
+// balanced, and the quadratic algorithm is used instead.
+template <size_t N, typename RealType>
+void multiply(RealType* r, RealType const* a, RealType const* b, size_t n = N, size_t lo = 0) {
+  using std::ldexp;
+  if (n < fast_multiply_threshold<RealType>::value) {
+    simd::multiply(simd::size_constant<N>{}, r, a, b, n);
+    return;
+  }
+  if (max_abs(a, n) == 0 || max_abs(b, n) == 0) {
+    for (size_t k = 0; k < n; ++k)
+      r[k] = 0;
+    return;
+  }
+  double const rate_a = decay_rate(a, n);
+  double const rate_b = decay_rate(b, n);
+  // Keep the scale factors well within the exponent range.
+  double const limit = static_cast<double>(std::numeric_limits<RealType>::max_exponent -
+                                           std::numeric_limits<RealType>::digits) /
+                       n;
+  double const slower = (std::max)(-limit, (std::min)(limit, (std::min)(rate_a, rate_b)));
+  double const faster = (std::max)(-limit, (std::min)(limit, (std::max)(rate_a, rate_b)));
+  balanced_operands<N, RealType> s;
+  if (n - lo < 8 * s.balance(slower, a, b, n, lo) && faster != slower) {
+    size_t const rejected = s.rejected;
+    if (rejected < s.balance(faster, a, b, n, lo))
+      s.balance(slower, a, b, n, lo);
+  }
+  if (n - lo < 4 * s.rejected) {
+    simd::multiply(simd::size_constant<N>{}, r, a, b, n);
+    return;
+  }
+  fast_product<N>(std::is_same<RealType, double>{}, r, s.a.data(), s.b.data(), n);
+  for (size_t k = lo; k < n; ++k)
+    if (s.magnitude[k] < s.tolerance)
+      r[k] = dot(a, b, k);
+    else if (s.is_scaled)
+      r[k] = ldexp(r[k], s.ea + s.eb) / s.scale[k];
+    else
+      r[k] = ldexp(r[k], s.ea + s.eb);
+}
+
+// a[0..n) /= b[0..n) as truncated power series, in place, n <= N. a must not alias b.
+// With m = n/2, the first m coefficients of the quotient q are solved for first. They determine
+// a[m..n) -= (q[0..m) * b)[m..n), after which the remaining n-m coefficients are solved for. The update is
+// the sum of two short products: of q[0..m) and b[m..n), and of the reversals of q[1..m) and b[1..m), whose
+// coefficients in reverse order are the high half of q[0..m) * b[0..m).
+template <size_t N, typename RealType>
+void divide_assign(RealType* a, RealType const* b, size_t n = N) {
+  if (n < fast_divide_threshold<RealType>::value) {
+    simd::divide_assign(simd::size_constant<N>{}, a, b, n);
+    return;
+  }
+  size_t const m = n / 2;
+  size_t const l = n - m;
+  divide_assign<N>(a, b, m);
+  workspace<RealType> x(N);
+  workspace<RealType> y(N);
+  workspace<RealType> p(N);
+  for (size_t i = 0; i < m; ++i)
+    x[i] = a[i];
+  x[m] = 0;
+  multiply<N>(p.data(), x.data(), b + m, l);
+  for (size_t i = 0; i < l; ++i)
+    a[m + i] -= p[i];
+  for (size_t i = 0; i + 1 < m; ++i) {
+    x[i] = a[m - 1 - i];
+    y[i] = b[m - 1 - i];
+  }
+  multiply<N>(p.data(), x.data(), y.data(), m - 1);
+  for (size_t i = 0; i + 1 < m; ++i)
+    a[2 * m - 2 - i] -= p[i];
+  divide_assign<N>(a + m, b, l);
+}
+
+// r[0..n) = a[0..n) / b[0..n) as truncated power series. r must not alias b.
+template <size_t N, typename RealType>
+void divide(RealType* r, RealType const* a, RealType const* b, size_t n = N) {
+  for (size_t i = 0; i < n; ++i)
+    r[i] = a[i];
+  divide_assign<N>(r, b, n);
+}
+
+// Newton iterations. Each step doubles the number k of correct coefficients, to m = min(2k,n), at the cost of
+// a few truncated products of length m, so that the total is within a constant factor of one product of
+// length n. The products are of operands whose first k coefficients are correct and whose others are 0.
+
+// r[0..n) = 1 / a[0..n). r <- r + r*(1 - a*r), where 1 - a*r is 0 below k.
+template <size_t N, typename RealType>
+void inverse(RealType* r, RealType const* a, size_t n = N) {
+  if (n < newton_inverse_threshold<RealType>::value) {
+    r[0] = 1;
+    for (size_t i = 1; i < n; ++i)
+      r[i] = 0;
+    divide_assign<N>(r, a, n);
+    return;
+  }
+  workspace<RealType> t(N);
+  workspace<RealType> u(N);
+  r[0] = 1 / a[0];
+  for (size_t k = 1; k < n; k = 2 * k < n ? 2 * k : n) {
+    size_t const m = 2 * k < n ? 2 * k : n;
+    for (size_t i = k; i < m; ++i)
+      r[i] = 0;
+    multiply<N>(t.data(), a, r, m, k);
+    multiply<N>(u.data(), r, t.data() + k, m - k);
+    for (size_t i = 0; i < m - k; ++i)
+      r[k + i] = -u[i];
+  }
+}
+
+// r[0..n) = sqrt(a[0..n)) = a * y, with y = 1/sqrt(a) by y <- y + y*(1 - a*y*y)/2.
+template <size_t N, typename RealType>
+void sqrt(RealType* r, RealType const* a, size_t n = N) {
+  using std::sqrt;
+  workspace<RealType> y(N);
+  workspace<RealType> t(N);
+  workspace<RealType> u(N);
+  y[0] = 1 / sqrt(a[0]);
+  for (size_t k = 1; k < n; k = 2 * k < n ? 2 * k : n) {
+    size_t const m = 2 * k < n ? 2 * k : n;
+    for (size_t i = k; i < m; ++i)
+      y[i] = 0;
+    multiply<N>(u.data(), y.data(), y.data(), m);
+    multiply<N>(t.data(), a, u.data(), m, k);
+    multiply<N>(u.data(), y.data(), t.data() + k, m - k);
+    for (size_t i = 0; i < m - k; ++i)
+      y[k + i] = -u[i] / 2;
+  }
+  multiply<N>(r, a, y.data(), n);
+}
+
+// r[0..n) = log(a[0..n)) = log(a[0]) + integral of a'/a.
+template <size_t N, typename RealType>
+void log(RealType* r, RealType const* a, size_t n = N) {
+  using std::log;
+  workspace<RealType> d(N);
+  for (size_t i = 1; i < n; ++i)
+    d[i - 1] = a[i] * static_cast<RealType>(i);
+  divide_assign<N>(d.data(), a, n - 1);
+  r[0] = log(a[0]);
+  for (size_t i = 1; i < n; ++i)
+    r[i] = d[i - 1] / static_cast<RealType>(i);
+}
+
+template <typename RealType>
+void exp_recurrence(RealType* r, RealType const* a, size_t n, RealType const& s);
+
+// r[0..n) = exp(a[0..n)). r <- r + r*(a - log(r)), where a - log(r) is 0 below k.
+template <size_t N, typename RealType>
+void exp(RealType* r, RealType const* a, size_t n = N) {
+  using std::exp;
+  r[0] = exp(a[0]);
+  // The error of the iterations is relative to the norm of r, which is far above the coefficients of the
+  // exp of a polynomial of low degree, as they decay faster than geometrically. exp_recurrence() computes
+  // each coefficient accurately, and in n times as many multiplications as a has terms, so for an a with
+  // few terms it is also the faster.
+  size_t terms = 0;
+  for (size_t k = 1; k < n; ++k)
+    terms += a[k] != 0;
+  if (4 * terms <= n) {
+    exp_recurrence(r, a, n, static_cast<RealType>(1));
+    return;
+  }
+  workspace<RealType> t(N);
+  workspace<RealType> u(N);
+  for (size_t k = 1; k < n; k = 2 * k < n ? 2 * k : n) {
+    size_t const m = 2 * k < n ? 2 * k : n;
+    for (size_t i = k; i < m; ++i)
+      r[i] = 0;
+    log<N>(t.data(), r, m);
+    for (size_t i = k; i < m; ++i)
+      t[i] = a[i] - t[i];
+    multiply<N>(u.data(), r, t.data() + k, m - k);
+    for (size_t i = 0; i < m - k; ++i)
+      r[k + i] = u[i];
+  }
+}
+
+// True if a[0..n) is 0 except for a[0] and a[1]. a[0] is not read.
+template <typename RealType>
+bool is_linear(RealType const* a, size_t n) {
+  for (size_t k = 2; k < n; ++k)
+    if (a[k] != 0)
+      return false;
+  return true;
+}
+
+// r[0..n) = a[0..n) * b[0..n) by multiply() where the fast product applies to length N, and otherwise by the
+// kernels of autodiff_simd.hpp.
+template <size_t N, typename RealType>
+void truncated_multiply(std::true_type, RealType* r, RealType const* a, RealType const* b, size_t n) {
+  multiply<N>(r, a, b, n);
+}
+
+template <size_t N, typename RealType>
+void truncated_multiply(std::false_type, RealType* r, RealType const* a, RealType const* b, size_t n) {
+  simd::multiply(simd::size_constant<N>{}, r, a, b, n);
+}
+
+// Same as compose() below, by the baby-step giant-step method of Paterson, Stockmeyer, Brent and Kung. With
+// k = ceil(sqrt(m+1)), the sum is that of b_j(e) * (e^k)^j, where b_j(e) is the sum of c(j*k+i) * e^i for i in
+// [0, k). The powers e^1..e^k take k products, of which each b_j is a linear combination, and the b_j are
+// summed by Horner's method in e^k in another m/k products, of which the j-th needs only r[0..n-j*k). This is
+// 2*sqrt(m) products instead of m, each of which is a fast product above its threshold.
+template <size_t N, typename RealType, typename Func>
+void compose_blocked(RealType* r, RealType const* e, size_t n, size_t m, Func const& c) {
+  using is_fast = has_fast_multiply<RealType, N - 1, RealType, N - 1>;
+  size_t k = 1;
+  while (k * k < m + 1)
+    ++k;
+  workspace<RealType> powers(k * n);  // e^i in powers[(i-1)*n..i*n) for i in [1, k].
+  powers[0] = 0;
+  for (size_t t = 1; t < n; ++t)
+    powers[t] = e[t];
+  for (size_t i = 2; i <= k; ++i)
+    truncated_multiply<N>(is_fast{}, &powers[(i - 1) * n], &powers[(i - 2) * n], powers.data(), n);
+  RealType const* const ek = &powers[(k - 1) * n];
+  workspace<RealType> product(N);
+  for (size_t t = 0; t < n; ++t)
+    r[t] = 0;
+  for (size_t j = m / k + 1; j--;) {
+    size_t const nj = n - j * k;
+    if (j != m / k) {
+      truncated_multiply<N>(is_fast{}, product.data(), r, ek, nj);
+      for (size_t t = 0; t < nj; ++t)
+        r[t] = product[t];
+    }
+    r[0] += c(j * k);
+    size_t const i_max = m - j * k < k ? m - j * k : k - 1;
+    for (size_t i = 1; i <= i_max; ++i) {
+      RealType const ci = c(j * k + i);
+      RealType const* const ei = &powers[(i - 1) * n];
+      for (size_t t = i; t < nj; ++t)
+        r[t] += ci * ei[t];
+    }
+  }
+}
+
+// r[0..n) = sum of c(i) * e^i for i in [0, m] by Horner's method, where m < n <= N. e[0] is taken to be 0 and
+// is not read. r must not alias e. From BOOST_AUTODIFF_COMPOSE_THRESHOLD terms, by compose_blocked() instead.
+template <size_t N, typename RealType, typename Func>
+void compose(RealType* r, RealType const* e, size_t n, size_t m, Func const& c) {
+  if (is_linear(e, n)) {
+    RealType ek(1);
+    for (size_t k = 0; k <= m; ++k, ek *= e[1])
+      r[k] = c(k) * ek;
+    for (size_t k = m + 1; k < n; ++k)
+      r[k] = 0;
+    return;
+  }
+  if (BOOST_AUTODIFF_COMPOSE_THRESHOLD <= m + 1) {
+    compose_blocked<N>(r, e, n, m, c);
+    return;
+  }
+  r[0] = c(m);
+  for (size_t k = 1; k < n; ++k)
+    r[k] = 0;
+  // r <- r * e + c(i). Only r[0..n-i) are needed by the remaining steps. Each r[k] depends only on r[0..k).
+  for (size_t i = m; i--;) {
+    for (size_t k = n - i - 1; k != 0; --k)
+      r[k] = dot(e + 1, r, k - 1);
+    r[0] = c(i);
+  }
+}
+
+// Same as compose(), summing the powers of e instead, where coefficients of e^i below i are neither
+// computed nor multiplied by c(i). An infinite c(i) then does not result in NaN coefficients below i.
+// w[0..n) is workspace, which must not alias e.
+template <typename RealType, typename Func>
+void compose_powers(RealType* r, RealType const* e, RealType* w, size_t n, size_t m, Func const& c) {
+  r[0] = c(0);
+  for (size_t k = 1; k < n; ++k)
+    r[k] = 0;
+  if (m == 0)
+    return;
+  if (is_linear(e, n)) {
+    RealType ek(e[1]);
+    for (size_t k = 1; k <= m; ++k, ek *= e[1])
+      r[k] = c(k) * ek;
+    return;
+  }
+  // w <- e^i, of which w[i-1..n) hold e^(i-1) on entry. Each w[k] depends only on w[i-1..k).
+  for (size_t k = 1; k < n; ++k)
+    w[k] = e[k];
+  for (size_t i = 1; i <= m; ++i) {
+    if (1 < i)
+      for (size_t k = n - 1; i <= k; --k)
+        w[k] = dot(e + 1, w + (i - 1), k - i);
+    RealType const ci = c(i);
+    for (size_t k = i; k < n; ++k)
+      r[k] += ci * w[k];
+  }
+}
+
+// Recurrences for y = f(a) from a linear differential equation in y, e.g. y' = y*a' for exp. Equating the
+// coefficients of e^(k-1) of both sides gives r[k] from a[1..k] and r[0..k). r[0] = f(a[0]) is set by the
+// caller, and r must not alias a. Terms of a that are 0 are skipped, so that an infinite r[0] does not turn
+// them into NaN, unless BOOST_AUTODIFF_FAST_MATH is defined. The sums stop at the last term of a that is not
+// 0, so that an a of the form a[0] + a[1]*e, as for an independent variable, takes O(n).
+
+// 1 + the index of the last coefficient of a[0..n) that is not 0, or 1 if there is none.
+template <typename RealType>
+size_t extent(RealType const* a, size_t n) {
+  while (1 < n && a[n - 1] == 0)
+    --n;
+  return n;
+}
+
+// r[0..n) = exp(s*a[0..n)), from y' = s*y*a': k*r[k] = s * sum j*a[j]*r[k-j] for j in [1, k].
+template <typename RealType>
+void exp_recurrence(RealType* r, RealType const* a, size_t n, RealType const& s) {
+  RealType const zero(0);
+  size_t const m = extent(a, n);
+  for (size_t k = 1; k < n; ++k) {
+    r[k] = zero;
+    for (size_t j = 1; j <= k && j < m; ++j)
+      if (fast_math::value || a[j] != zero)
+        r[k] += static_cast<RealType>(j) * a[j] * r[k - j];
+    r[k] *= s / static_cast<RealType>(k);
+  }
+}
+
+// r[0..n) = log(a[0..n)), from a*y' = a': a[0]*k*r[k] = k*a[k] - sum j*r[j]*a[k-j] for j in [1, k).
+template <typename RealType>
+void log_recurrence(RealType* r, RealType const* a, size_t n) {
+  RealType const zero(0);
+  size_t const m = extent(a, n);
+  for (size_t k = 1; k < n; ++k) {
+    r[k] = zero;
+    for (size_t j = k < m ? 1 : k + 1 - m; j < k; ++j)
+      if (fast_math::value || a[k - j] != zero)
+        r[k] += static_cast<RealType>(j) * r[j] * a[k - j];
+    r[k] = (a[k] - r[k] / static_cast<RealType>(k)) / a[0];
+  }
+}
+
+// r[0..n) = a[0..n)^p, from a*y' = p*y*a': a[0]*k*r[k] = sum ((p+1)*j-k)*a[j]*r[k-j] for j in [1, k].
+// For a linear a and integral p, the factor (p+1)*j-k is exactly 0 from k = p+1 on, as are the coefficients.
+template <typename RealType>
+void pow_recurrence(RealType* r, RealType const* a, size_t n, RealType const& p) {
+  RealType const zero(0);
+  RealType const p1 = p + 1;
+  size_t const m = extent(a, n);
+  for (size_t k = 1; k < n; ++k) {
+    r[k] = zero;
+    for (size_t j = 1; j <= k && j < m; ++j)
+      if (fast_math::value || a[j] != zero)
+        r[k] += (p1 * static_cast<RealType>(j) - static_cast<RealType>(k)) * a[j] * r[k - j];
+    r[k] /= static_cast<RealType>(k) * a[0];
+  }
+}
+
+// s[0..n) = sin(a[0..n)) and c[0..n) = cos(a[0..n)) for sign = -1, or sinh and cosh for sign = 1, from the
+// coupled s' = c*a' and c' = sign*s*a'. s[0] and c[0] are set by the caller.
+template <typename RealType>
+void sincos_recurrence(RealType* s, RealType* c, RealType const* a, size_t n, RealType const& sign) {
+  RealType const zero(0);
+  size_t const m = extent(a, n);
+  for (size_t k = 1; k < n; ++k) {
+    s[k] = zero;
+    c[k] = zero;
+    for (size_t j = 1; j <= k && j < m; ++j)
+      if (fast_math::value || a[j] != zero) {
+        RealType const ja = static_cast<RealType>(j) * a[j];
+        s[k] += ja * c[k - j];
+        c[k] += ja * s[k - j];
+      }
+    s[k] /= static_cast<RealType>(k);
+    c[k] *= sign / static_cast<RealType>(k);
+  }
+}
+
+// r[0..n) = tan(a[0..n)) for sign = 1, or tanh for sign = -1, from y' = (1 + sign*y^2)*a'. w[0..n) is
+// workspace for 1 + sign*y^2, whose coefficient k follows from r[0..k]. r[0] is set by the caller.
+template <typename RealType>
+void tan_recurrence(RealType* r, RealType const* a, RealType* w, size_t n, RealType const& sign) {
+  RealType const zero(0);
+  w[0] = static_cast<RealType>(1) + sign * r[0] * r[0];
+  size_t const m = extent(a, n);
+  for (size_t k = 1; k < n; ++k) {
+    r[k] = zero;
+    for (size_t j = 1; j <= k && j < m; ++j)
+      if (fast_math::value || a[j] != zero)
+        r[k] += static_cast<RealType>(j) * a[j] * w[k - j];
+    r[k] /= static_cast<RealType>(k);
+    // w[k] = sign * sum r[i]*r[k-i] for i in [0, k], of which each product but the middle one appears twice.
+    w[k] = zero;
+    for (size_t i = 0; 2 * i < k; ++i)
+      w[k] += r[i] * r[k - i];
+    w[k] *= 2;
+    if (k % 2 == 0)
+      w[k] += r[k / 2] * r[k / 2];
+    w[k] *= sign;
+  }
+}
+
+// r[0..n) = a[0..n)^2, in n^2/4 multiplications, or O(n) for an a of the form a[0] + a[1]*e.
+template <typename RealType>
+void square(RealType* r, RealType const* a, size_t n) {
+  RealType const zero(0);
+  size_t const m = extent(a, n);
+  for (size_t k = 0; k < n; ++k) {
+    r[k] = zero;
+    for (size_t i = k < m ? 0 : k + 1 - m; 2 * i < k; ++i)
+      r[k] += a[i] * a[k - i];
+    r[k] *= 2;
+    if (k % 2 == 0)
+      r[k] += a[k / 2] * a[k / 2];
+  }
+}
+
+// The inverse trigonometric and hyperbolic functions and erf have derivatives of the form c/q(a) or c*q(a),
+// where q(a) is a power or the exponential of a quadratic in a, whose series is found by the recurrences above.
+// Integrating y' = c*a'/q or y' = c*a'*q is again a recurrence. r[0] is set by the caller.
+
+// r[1..n) from q*y' = c*a': k*q[0]*r[k] = c*k*a[k] - sum (k-i)*q[i]*r[k-i] for i in [1, k).
+template <typename RealType>
+void integrate_quotient(RealType* r, RealType const* a, RealType const* q, size_t n, RealType const& c) {
+  RealType const zero(0);
+  size_t const m = extent(q, n);
+  for (size_t k = 1; k < n; ++k) {
+    r[k] = zero;
+    for (size_t i = 1; i < k && i < m; ++i)
+      if (fast_math::value || q[i] != zero)
+        r[k] += static_cast<RealType>(k - i) * q[i] * r[k - i];
+    r[k] = (c * a[k] - r[k] / static_cast<RealType>(k)) / q[0];
+  }
+}
+
+// r[1..n) from y' = c*a'*q: k*r[k] = c * sum j*a[j]*q[k-j] for j in [1, k].
+template <typename RealType>
+void integrate_product(RealType* r, RealType const* a, RealType const* q, size_t n, RealType const& c) {
+  RealType const zero(0);
+  size_t const m = extent(a, n);
+  for (size_t k = 1; k < n; ++k) {
+    r[k] = zero;
+    for (size_t j = 1; j <= k && j < m; ++j)
+      if (fast_math::value || a[j] != zero)
+        r[k] += static_cast<RealType>(j) * a[j] * q[k - j];
+    r[k] *= c / static_cast<RealType>(k);
+  }
+}
+
+// Entry points of the fvar operators. The std::false_type overloads are never called. They exist because
+// without if constexpr the branches that call these are compiled for all operand types.
+
+template <size_t N, typename RealType, typename RealType1, typename RealType2>
+void multiply(std::false_type, RealType*, RealType1 const*, RealType2 const*) {}
+
+template <size_t N, typename RealType>
+void multiply(std::true_type, RealType* r, RealType const* a, RealType const* b) {
+  multiply<N>(r, a, b);
+}
+
+template <size_t N, typename RealType, typename RealType2>
+void multiply_assign(std::false_type, RealType*, RealType2 const*) {}
+
+template <size_t N, typename RealType>
+void multiply_assign(std::true_type, RealType* a, RealType const* b) {
+  workspace<RealType> c(N);
+  for (size_t i = 0; i < N; ++i)
+    c[i] = a[i];
+  multiply<N>(a, c.data(), b);
+}
+
+template <size_t N, typename RealType, typename RealType1, typename RealType2>
+void divide(std::false_type, RealType*, RealType1 const*, RealType2 const*) {}
+
+template <size_t N, typename RealType>
+void divide(std::true_type, RealType* r, RealType const* a, RealType const* b) {
+  divide<N>(r, a, b);
+}
+
+template <size_t N, typename RealType, typename RealType2>
+void divide_assign(std::false_type, RealType*, RealType2 const*) {}
+
+template <size_t N, typename RealType>
+void divide_assign(std::true_type, RealType* a, RealType const* b) {
+  divide_assign<N>(a, b);
+}
+
+template <size_t N, typename RealType, typename RealType1>
+void inverse(std::false_type, RealType*, RealType1 const*) {}
+
+template <size_t N, typename RealType>
+void inverse(std::true_type, RealType* r, RealType const* a) {
+  inverse<N>(r, a);
+}
+
+template <size_t N, typename RealType, typename RealType1>
+void sqrt(std::false_type, RealType*, RealType1 const*) {}
+
+template <size_t N, typename RealType>
+void sqrt(std::true_type, RealType* r, RealType const* a) {
+  sqrt<N>(r, a);
+}
+
+template <size_t N, typename RealType, typename RealType1>
+void log(std::false_type, RealType*, RealType1 const*) {}
+
+template <size_t N, typename RealType>
+void log(std::true_type, RealType* r, RealType const* a) {
+  log<N>(r, a);
+}
+
+template <size_t N, typename RealType, typename RealType1>
+void exp(std::false_type, RealType*, RealType1 const*) {}
+
+template <size_t N, typename RealType>
+void exp(std::true_type, RealType* r, RealType const* a) {
+  exp<N>(r, a);
+}
+
+}  // namespace series
+
+}  // namespace detail
+}  // namespace autodiff_v1
+}  // namespace differentiation
+}  // namespace math
+}  // namespace boost
+
+#endif  // BOOST_MATH_DIFFERENTIATION_DETAIL_AUTODIFF_SERIES_HPP
@@ -0,0 +1,430 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+// Notes:
+//  * Truncated power series product and quotient kernels for fvar<float,Order> and fvar<double,Order>.
+//    Both are written as a sequence of axpy operations y[0..n) += alpha*x[0..n) over contiguous
+//    coefficients, rather than the dot products over reversed iterators used by the generic code in
+//    autodiff.hpp, so that each step maps onto full-width vector loads and stores.
+//  * The axpy is written with SSE2/AVX/AVX-512 intrinsics when the corresponding instruction set is enabled
+//    at compile time. Define BOOST_AUTODIFF_NO_SIMD to disable these kernels altogether.
+//  * Below BOOST_AUTODIFF_UNROLL_THRESHOLD coefficients the kernels are unrolled at compile time instead,
+//    which is faster than any vector loads.
+
+#ifndef BOOST_MATH_DIFFERENTIATION_AUTODIFF_HPP
+#error "Do not #include this file directly. This should only be #included by autodiff.hpp."
+#endif
+
+#ifndef BOOST_MATH_DIFFERENTIATION_DETAIL_AUTODIFF_SIMD_HPP
+#define BOOST_MATH_DIFFERENTIATION_DETAIL_AUTODIFF_SIMD_HPP
+
+#include <boost/mp11/integer_sequence.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+#ifndef BOOST_AUTODIFF_UNROLL_THRESHOLD
+#define BOOST_AUTODIFF_UNROLL_THRESHOLD 10
+#endif
+
+#ifndef BOOST_AUTODIFF_NO_SIMD
+#if defined(__AVX512F__)
+#define BOOST_AUTODIFF_SIMD_AVX512
+#include <immintrin.h>
+#elif defined(__AVX__)
+#define BOOST_AUTODIFF_SIMD_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && 2 <= _M_IX86_FP)
+#define BOOST_AUTODIFF_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#endif
+
+namespace boost {
+namespace math {
+namespace differentiation {
+inline namespace autodiff_v1 {
+namespace detail {
+namespace simd {
+
+// True when fvar<RealType,Order> op fvar<RealType2,Order2> can be evaluated by the kernels below.
+template <typename RealType, size_t Order, typename RealType2, size_t Order2>
+struct has_kernel
+    : std::integral_constant<bool,
+#ifdef BOOST_AUTODIFF_NO_SIMD
+                             false
+#else
+                             Order == Order2 && std::is_same<RealType, RealType2>::value &&
+                                 (std::is_same<RealType, float>::value ||
+                                  std::is_same<RealType, double>::value)
+#endif
+                             > {
+};
+
+template <size_t N>
+using size_constant = std::integral_constant<size_t, N>;
+
+// Returned by each axpy() below, so that the overload a kernel selects can be checked at compile time.
+using scalar_kernel = std::false_type;
+using vector_kernel = std::true_type;
+
+// y[0..n) += alpha * x[0..n)
+template <typename RealType, typename RealType2>
+inline scalar_kernel axpy(RealType* y, RealType2 const& alpha, RealType2 const* x, size_t n) {
+  for (size_t i = 0; i < n; ++i)
+    y[i] += alpha * x[i];
+  return {};
+}
+
+#if defined(BOOST_AUTODIFF_SIMD_AVX512)
+
+// y[0..n) += alpha * x[0..n) for n < 8, by masked loads and stores.
+inline void axpy_masked(double* y, __m512d const a, double const* x, size_t n) {
+  if (n != 0) {
+    __mmask8 const mask = static_cast<__mmask8>((1u << n) - 1);
+    __m512d const yi = _mm512_maskz_loadu_pd(mask, y);
+    _mm512_mask_storeu_pd(y, mask, _mm512_fmadd_pd(a, _mm512_maskz_loadu_pd(mask, x), yi));
+  }
+}
+
+// y[0..n) += alpha * x[0..n) for n < 16, by masked loads and stores.
+inline void axpy_masked(float* y, __m512 const a, float const* x, size_t n) {
+  if (n != 0) {
+    __mmask16 const mask = static_cast<__mmask16>((1u << n) - 1);
+    __m512 const yi = _mm512_maskz_loadu_ps(mask, y);
+    _mm512_mask_storeu_ps(y, mask, _mm512_fmadd_ps(a, _mm512_maskz_loadu_ps(mask, x), yi));
+  }
+}
+
+inline vector_kernel axpy(double* y, double const& alpha, double const* x, size_t n) {
+  size_t i = 0;
+  __m512d const a = _mm512_set1_pd(alpha);
+  for (; i + 8 <= n; i += 8)
+    _mm512_storeu_pd(y + i, _mm512_fmadd_pd(a, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+  axpy_masked(y + i, a, x + i, n - i);
+  return {};
+}
+
+inline vector_kernel axpy(float* y, float const& alpha, float const* x, size_t n) {
+  size_t i = 0;
+  __m512 const a = _mm512_set1_ps(alpha);
+  for (; i + 16 <= n; i += 16)
+    _mm512_storeu_ps(y + i, _mm512_fmadd_ps(a, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+  axpy_masked(y + i, a, x + i, n - i);
+  return {};
+}
+
+// Below one vector of coefficients, only the masked tail. The full-width loop would not be taken, but GCC
+// cannot tell, and warns of its loads and stores past the end of storage of N coefficients.
+template <size_t N>
+inline vector_kernel axpy(size_constant<N>, double* y, double const& alpha, double const* x, size_t n) {
+  if (N < 8)
+    axpy_masked(y, _mm512_set1_pd(alpha), x, n);
+  else
+    axpy(y, alpha, x, n);
+  return {};
+}
+
+template <size_t N>
+inline vector_kernel axpy(size_constant<N>, float* y, float const& alpha, float const* x, size_t n) {
+  if (N < 16)
+    axpy_masked(y, _mm512_set1_ps(alpha), x, n);
+  else
+    axpy(y, alpha, x, n);
+  return {};
+}
+
+#elif defined(BOOST_AUTODIFF_SIMD_AVX)
+
+inline vector_kernel axpy(double* y, double const& alpha, double const* x, size_t n) {
+  size_t i = 0;
+  __m256d const a = _mm256_set1_pd(alpha);
+  for (; i + 4 <= n; i += 4)
+#ifdef __FMA__
+    _mm256_storeu_pd(y + i, _mm256_fmadd_pd(a, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+#else
+    _mm256_storeu_pd(y + i, _mm256_add_pd(_mm256_loadu_pd(y + i), _mm256_mul_pd(a, _mm256_loadu_pd(x + i))));
+#endif
+  for (; i < n; ++i)
+    y[i] += alpha * x[i];
+  return {};
+}
+
+inline vector_kernel axpy(float* y, float const& alpha, float const* x, size_t n) {
+  size_t i = 0;
+  __m256 const a = _mm256_set1_ps(alpha);
+  for (; i + 8 <= n; i += 8)
+#ifdef __FMA__
+    _mm256_storeu_ps(y + i, _mm256_fmadd_ps(a, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+#else
+    _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(a, _mm256_loadu_ps(x + i))));
+#endif
+  for (; i < n; ++i)
+    y[i] += alpha * x[i];
+  return {};
+}
+
+#elif defined(BOOST_AUTODIFF_SIMD_SSE2)
+
+inline vector_kernel axpy(double* y, double const& alpha, double const* x, size_t n) {
+  size_t i = 0;
+  __m128d const a = _mm_set1_pd(alpha);
+  for (; i + 2 <= n; i += 2)
+    _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i), _mm_mul_pd(a, _mm_loadu_pd(x + i))));
+  if (i < n)
+    y[i] += alpha * x[i];
+  return {};
+}
+
+inline vector_kernel axpy(float* y, float const& alpha, float const* x, size_t n) {
+  size_t i = 0;
+  __m128 const a = _mm_set1_ps(alpha);
+  for (; i + 4 <= n; i += 4)
+    _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(a, _mm_loadu_ps(x + i))));
+  for (; i < n; ++i)
+    y[i] += alpha * x[i];
+  return {};
+}
+
+#endif
+
+// y[0..n) += alpha * x[0..n), where n <= N is known at compile time. Defined after the overloads for each
+// instruction set, which the unqualified call finds only by ordinary lookup: double* has no associated
+// namespace.
+template <size_t N, typename RealType, typename RealType2>
+inline auto axpy(size_constant<N>, RealType* y, RealType2 const& alpha, RealType2 const* x, size_t n)
+    -> decltype(axpy(y, alpha, x, n)) {
+  return axpy(y, alpha, x, n);
+}
+
+// The kernels below take n <= N coefficients, where the bound N is known at compile time, or else is the
+// largest size_t. Only axpy() makes use of it.
+using unbounded = size_constant<static_cast<size_t>(-1)>;
+
+// a[0..n) *= b[0..n) as truncated power series, in place. a must not alias b.
+// Columns are accumulated from the highest coefficient of a down, so that each a[k] is read before it is
+// overwritten: a[k] <- a[k]*b[0], then a[k+1..n) += a_k * b[1..n-k).
+template <size_t N, typename RealType, typename RealType2>
+inline void multiply_assign(size_constant<N> bound, RealType* a, RealType2 const* b, size_t n) {
+  for (size_t k = n; k--;) {
+    RealType2 const ak = static_cast<RealType2>(a[k]);
+    a[k] *= b[0];
+    axpy(bound, a + k + 1, ak, b + 1, n - k - 1);
+  }
+}
+
+template <typename RealType, typename RealType2>
+inline void multiply_assign(RealType* a, RealType2 const* b, size_t n) {
+  multiply_assign(unbounded{}, a, b, n);
+}
+
+// r[0..n) = a[0..n) * b[0..n) as truncated power series. r must not alias a or b.
+template <size_t N, typename RealType, typename RealType1, typename RealType2>
+inline void multiply(size_constant<N> bound,
+                     RealType* r,
+                     RealType1 const* a,
+                     RealType2 const* b,
+                     size_t n) {
+  for (size_t i = 0; i < n; ++i)
+    r[i] = a[i];
+  multiply_assign(bound, r, b, n);
+}
+
+template <typename RealType, typename RealType1, typename RealType2>
+inline void multiply(RealType* r, RealType1 const* a, RealType2 const* b, size_t n) {
+  multiply(unbounded{}, r, a, b, n);
+}
+
+// r[0..n) += a[0..n) * b[0..n) as truncated power series. r must not alias a or b.
+template <typename RealType, typename RealType1, typename RealType2>
+inline void multiply_add(RealType* r, RealType1 const* a, RealType2 const* b, size_t n) {
+  for (size_t k = 0; k < n; ++k)
+    axpy(r + k, static_cast<RealType2>(a[k]), b, n - k);
+}
+
+// a[0..n) /= b[0..n) as truncated power series, in place. a must not alias b.
+// Forward substitution by columns: once a[k] holds the k-th coefficient of the quotient,
+// a[k+1..n) -= a[k] * b[1..n-k).
+template <size_t N, typename RealType, typename RealType2>
+inline void divide_assign(size_constant<N> bound, RealType* a, RealType2 const* b, size_t n) {
+  for (size_t k = 0; k < n; ++k) {
+    a[k] /= b[0];
+    axpy(bound, a + k + 1, static_cast<RealType2>(-a[k]), b + 1, n - k - 1);
+  }
+}
+
+template <typename RealType, typename RealType2>
+inline void divide_assign(RealType* a, RealType2 const* b, size_t n) {
+  divide_assign(unbounded{}, a, b, n);
+}
+
+// r[0..n) = a[0..n) / b[0..n) as truncated power series. r must not alias b.
+template <typename RealType, typename RealType1, typename RealType2>
+inline void divide(RealType* r, RealType1 const* a, RealType2 const* b, size_t n) {
+  for (size_t i = 0; i < n; ++i)
+    r[i] = a[i];
+  divide_assign(r, b, n);
+}
+
+// The kernels above for a number of coefficients N fixed at compile time. Below
+// BOOST_AUTODIFF_UNROLL_THRESHOLD coefficients, each coefficient of a product or quotient is instead written
+// out as a sum generated from an index_sequence, in the same order of operations. Over so few coefficients
+// the vector loads of axpy() wait on the stores of the preceding column, and the loops are not unrolled.
+// std::index_sequence is C++14.
+using boost::mp11::index_sequence;
+using boost::mp11::make_index_sequence;
+
+// Of one RealType, as has_kernel selects. Others reach these kernels only in branches that are compiled
+// without if constexpr, and never taken.
+template <size_t N, typename RealType, typename RealType1, typename RealType2 = RealType1>
+using is_unrolled = std::integral_constant<bool,
+                                           N < BOOST_AUTODIFF_UNROLL_THRESHOLD &&
+                                               std::is_same<RealType, RealType1>::value &&
+                                               std::is_same<RealType, RealType2>::value>;
+
+using expand = int[];  // Evaluates a pack expansion in order, as a fold expression would in C++17.
+
+// a[K]*b[0] + a[K-1]*b[1] + ... + a[0]*b[K]
+template <size_t K, typename RealType, typename RealType2, size_t... I>
+inline RealType product_column(RealType const* a, RealType2 const* b, index_sequence<I...>) {
+  RealType sum = a[K] * b[0];
+  (void)expand{0, (sum += a[K - 1 - I] * b[1 + I], 0)...};
+  return sum;
+}
+
+// r[K] + a[0]*b[K] + a[1]*b[K-1] + ... + a[K]*b[0]
+template <size_t K, typename RealType, typename RealType1, typename RealType2, size_t... I>
+inline RealType product_add_column(RealType const* r,
+                                   RealType1 const* a,
+                                   RealType2 const* b,
+                                   index_sequence<I...>) {
+  RealType sum = r[K];
+  (void)expand{0, (sum += a[I] * b[K - I], 0)...};
+  return sum;
+}
+
+// (a[K] - q[0]*b[K] - q[1]*b[K-1] - ... - q[K-1]*b[1]) / b[0]
+template <size_t K, typename RealType, typename RealType1, typename RealType2, size_t... I>
+inline RealType quotient_column(RealType1 const* a,
+                                RealType const* q,
+                                RealType2 const* b,
+                                index_sequence<I...>) {
+  RealType difference = a[K];
+  (void)q;  // Unused for K=0.
+  (void)expand{0, (difference -= q[I] * b[K - I], 0)...};
+  return difference / b[0];
+}
+
+// The columns of a product in place are computed from the highest down, and those of a quotient from the
+// lowest up, so that each reads only the coefficients of a that it has not yet overwritten.
+template <typename RealType, typename RealType2, size_t... K>
+inline void multiply_assign(std::true_type, RealType* a, RealType2 const* b, index_sequence<K...>) {
+  constexpr size_t n = sizeof...(K);
+  (void)expand{0,
+               (a[n - 1 - K] = product_column<n - 1 - K>(a, b, make_index_sequence<n - 1 - K>{}), 0)...};
+}
+
+template <typename RealType, typename RealType2, size_t... K>
+inline void multiply_assign(std::false_type, RealType* a, RealType2 const* b, index_sequence<K...>) {
+  multiply_assign(a, b, sizeof...(K));
+}
+
+template <size_t N, typename RealType, typename RealType2>
+inline void multiply_assign(size_constant<N>, RealType* a, RealType2 const* b) {
+  multiply_assign(is_unrolled<N, RealType, RealType2>{}, a, b, make_index_sequence<N>{});
+}
+
+template <typename RealType, typename RealType1, typename RealType2, size_t... K>
+inline void multiply(std::true_type,
+                     RealType* r,
+                     RealType1 const* a,
+                     RealType2 const* b,
+                     index_sequence<K...>) {
+  (void)expand{0, (r[K] = product_column<K>(a, b, make_index_sequence<K>{}), 0)...};
+}
+
+template <typename RealType, typename RealType1, typename RealType2, size_t... K>
+inline void multiply(std::false_type,
+                     RealType* r,
+                     RealType1 const* a,
+                     RealType2 const* b,
+                     index_sequence<K...>) {
+  multiply(r, a, b, sizeof...(K));
+}
+
+template <size_t N, typename RealType, typename RealType1, typename RealType2>
+inline void multiply(size_constant<N>, RealType* r, RealType1 const* a, RealType2 const* b) {
+  multiply(is_unrolled<N, RealType, RealType1, RealType2>{}, r, a, b, make_index_sequence<N>{});
+}
+
+template <typename RealType, typename RealType1, typename RealType2, size_t... K>
+inline void multiply_add(std::true_type,
+                         RealType* r,
+                         RealType1 const* a,
+                         RealType2 const* b,
+                         index_sequence<K...>) {
+  (void)expand{0, (r[K] = product_add_column<K>(r, a, b, make_index_sequence<K + 1>{}), 0)...};
+}
+
+template <typename RealType, typename RealType1, typename RealType2, size_t... K>
+inline void multiply_add(std::false_type,
+                         RealType* r,
+                         RealType1 const* a,
+                         RealType2 const* b,
+                         index_sequence<K...>) {
+  multiply_add(r, a, b, sizeof...(K));
+}
+
+template <size_t N, typename RealType, typename RealType1, typename RealType2>
+inline void multiply_add(size_constant<N>, RealType* r, RealType1 const* a, RealType2 const* b) {
+  multiply_add(is_unrolled<N, RealType, RealType1, RealType2>{}, r, a, b, make_index_sequence<N>{});
+}
+
+template <typename RealType, typename RealType2, size_t... K>
+inline void divide_assign(std::true_type, RealType* a, RealType2 const* b, index_sequence<K...>) {
+  (void)expand{0, (a[K] = quotient_column<K>(a, a, b, make_index_sequence<K>{}), 0)...};
+}
+
+template <typename RealType, typename RealType2, size_t... K>
+inline void divide_assign(std::false_type, RealType* a, RealType2 const* b, index_sequence<K...>) {
+  divide_assign(a, b, sizeof...(K));
+}
+
+template <size_t N, typename RealType, typename RealType2>
+inline void divide_assign(size_constant<N>, RealType* a, RealType2 const* b) {
+  divide_assign(is_unrolled<N, RealType, RealType2>{}, a, b, make_index_sequence<N>{});
+}
+
+template <typename RealType, typename RealType1, typename RealType2, size_t... K>
+inline void divide(std::true_type,
+                   RealType* r,
+                   RealType1 const* a,
+                   RealType2 const* b,
+                   index_sequence<K...>) {
+  (void)expand{0, (r[K] = quotient_column<K>(a, r, b, make_index_sequence<K>{}), 0)...};
+}
+
+template <typename RealType, typename RealType1, typename RealType2, size_t... K>
+inline void divide(std::false_type,
+                   RealType* r,
+                   RealType1 const* a,
+                   RealType2 const* b,
+                   index_sequence<K...>) {
+  divide(r, a, b, sizeof...(K));
+}
+
+template <size_t N, typename RealType, typename RealType1, typename RealType2>
+inline void divide(size_constant<N>, RealType* r, RealType1 const* a, RealType2 const* b) {
+  divide(is_unrolled<N, RealType, RealType1, RealType2>{}, r, a, b, make_index_sequence<N>{});
+}
+
+}  // namespace simd
+}  // namespace detail
+}  // namespace autodiff_v1
+}  // namespace differentiation
+}  // namespace math
+}  // namespace boost
+
+#endif  // BOOST_MATH_DIFFERENTIATION_DETAIL_AUTODIFF_SIMD_HPP
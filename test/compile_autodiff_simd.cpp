@@ -0,0 +1,58 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+// Compiled with each of -msse2, -mavx2 and -mavx512f, and -Wall -Werror at -O2, by the Jamfile. The truncated
+// products of compose_blocked() at Orders below the width of a vector are of a length known only at run time,
+// within storage of fewer coefficients than one full-width load. Composition is forced through
+// compose_blocked() at every Order. The products and quotients must select the axpy() of the instruction set.
+
+#define BOOST_AUTODIFF_COMPOSE_THRESHOLD 2
+#include <boost/math/differentiation/autodiff.hpp>
+
+#include <utility>
+
+namespace {
+
+using namespace boost::math::differentiation;
+
+template <typename T, std::size_t N>
+using selected_axpy = decltype(detail::simd::axpy(detail::simd::size_constant<N>{},
+                                                  std::declval<T*>(),
+                                                  std::declval<T const&>(),
+                                                  std::declval<T const*>(),
+                                                  std::size_t()));
+
+template <typename T>
+constexpr bool is_vectorized() {
+  return selected_axpy<T, 3>::value && selected_axpy<T, 20>::value &&
+         selected_axpy<T, detail::simd::unbounded::value>::value;
+}
+
+#if defined(BOOST_AUTODIFF_SIMD_AVX512) || defined(BOOST_AUTODIFF_SIMD_AVX) || \
+    defined(BOOST_AUTODIFF_SIMD_SSE2)
+static_assert(is_vectorized<double>(), "The products of fvar<double,Order> take the scalar axpy().");
+static_assert(is_vectorized<float>(), "The products of fvar<float,Order> take the scalar axpy().");
+#endif
+
+template <typename T, std::size_t Order>
+T compose(T const x0) {
+  auto const x = make_fvar<T, Order>(x0);
+  auto const f = (x * x).apply_coefficients(Order, [](std::size_t i) { return T(1) / (i + 1); });
+  auto const g = (x * x).apply_derivatives(Order, [](std::size_t i) { return T(i + 1); });
+  return (f * g / (x + 1)).derivative(Order);
+}
+
+template <typename T>
+T compose_all(T const x0) {
+  return compose<T, 2>(x0) + compose<T, 3>(x0) + compose<T, 5>(x0) + compose<T, 6>(x0) +
+         compose<T, 7>(x0) + compose<T, 9>(x0) + compose<T, 12>(x0) + compose<T, 15>(x0) +
+         compose<T, 20>(x0);
+}
+
+}  // namespace
+
+double compile_autodiff_simd(double const x0) {
+  return compose_all(x0) + compose_all(static_cast<float>(x0));
+}
@@ -19,6 +19,7 @@
 #include <boost/math/differentiation/autodiff.hpp>
 #include <boost/multiprecision/cpp_bin_float.hpp>
 #include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/mp11/algorithm.hpp>
 #include <boost/mp11/function.hpp>
 #include <boost/mp11/integral.hpp>
 #include <boost/mp11/list.hpp>
@@ -176,6 +177,14 @@ auto isNearZero(const T& t) noexcept -> typename std::enable_if<detail::is_fvar<
 template <typename T, std::size_t Order = 5>
 using test_constants_t = test_detail::test_constants_t<T, Order>;
 
+// Checks the derivatives of orders 0 to n of x against those of y, which may be of another Order or root_type,
+// to within eps percent.
+template <typename X, typename Y, typename T>
+void check_derivatives_close(const X& x, const Y& y, std::size_t n, const T& eps) {
+  for (auto i : boost::irange(n + 1))
+    BOOST_CHECK_CLOSE(x.derivative(i), static_cast<T>(y.derivative(i)), eps);
+}
+
 template <typename W, typename X, typename Y, typename Z>
 promote<W, X, Y, Z> mixed_partials_f(const W& w, const X& x, const Y& y,
                                      const Z& z) {
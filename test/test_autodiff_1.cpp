@@ -197,6 +197,21 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(subtraction_assignment, T, all_float_types) {
   }
 }
 
+// The nested operand is of a lower Order than the result. Subtracting it must not read past its end.
+BOOST_AUTO_TEST_CASE_TEMPLATE(nested_subtraction_assignment, T, all_float_types) {
+  const T cx = 3.0;
+  const T cy = 4.0;
+  const auto variables = make_ftuple<T, 1, 1>(cx, cy);
+  const auto &x = std::get<0>(variables);
+  const auto &y = std::get<1>(variables);
+  auto d = x * y;
+  d -= y;  // x*y - y
+  BOOST_CHECK_EQUAL(d.derivative(0, 0), cx * cy - cy);
+  BOOST_CHECK_EQUAL(d.derivative(1, 0), cy);
+  BOOST_CHECK_EQUAL(d.derivative(0, 1), cx - 1);
+  BOOST_CHECK_EQUAL(d.derivative(1, 1), 1.0);
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(multiplication_assignment, T, all_float_types) {
   // Try explicit bracing based on feedback. Doesn't add very much except 26
   // extra lines.
@@ -578,6 +593,47 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(division, T, all_float_types) {
   }
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(high_order_multiplication_and_division, T, all_float_types) {
+  // Order is not a multiple of any vector width so that the tail of each kernel is exercised too.
+  constexpr std::size_t m = 21;
+  constexpr int k = 6;
+  const T cx = 2.0;
+  const auto x = make_fvar<T, m>(cx);
+  const auto x6 = x * x * x * x * x * x;
+  auto x6_assign = x;
+  for (int i = 1; i < k; ++i) {
+    x6_assign *= x;
+  }
+  // d^i/dx^i x^k = k!/(k-i)! x^(k-i), which is exact for these values.
+  for (auto i : boost::irange(m + 1)) {
+    const T expected =
+        i <= k ? boost::math::factorial<T>(k) / boost::math::factorial<T>(static_cast<unsigned>(k - i)) *
+                     pow(cx, k - static_cast<int>(i))
+               : T(0);
+    BOOST_CHECK_EQUAL(x6.derivative(i), expected);
+    BOOST_CHECK_EQUAL(x6_assign.derivative(i), expected);
+  }
+  const auto x4 = x6 / (x * x);
+  auto x4_assign = x6;
+  x4_assign /= x;
+  x4_assign /= x;
+  for (auto i : boost::irange(m + 1)) {
+    const T expected =
+        i <= 4 ? boost::math::factorial<T>(4) / boost::math::factorial<T>(static_cast<unsigned>(4 - i)) *
+                     pow(cx, 4 - static_cast<int>(i))
+               : T(0);
+    BOOST_CHECK_EQUAL(x4.derivative(i), expected);
+    BOOST_CHECK_EQUAL(x4_assign.derivative(i), expected);
+  }
+  const auto xinv = 1 / x;
+  for (auto i : boost::irange(m + 1)) {
+    BOOST_CHECK_CLOSE(xinv.derivative(i),
+                      (i % 2 == 1 ? -1 : 1) * boost::math::factorial<T>(static_cast<unsigned>(i)) /
+                          pow(cx, static_cast<int>(i) + 1),
+                      test_constants_t<T>::pct_epsilon());
+  }
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(equality, T, all_float_types) {
   constexpr std::size_t m = 3;
   constexpr std::size_t n = 4;
@@ -0,0 +1,111 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+#include <boost/math/differentiation/autodiff_total_degree.hpp>
+#include <boost/mp11/tuple.hpp>
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_10)
+
+struct total_degree_test_function {
+  template <typename W, typename X, typename Y, typename Z>
+  promote<W, X, Y, Z> operator()(W const& w, X const& x, Y const& y, Z const& z) const {
+    using std::exp;
+    using std::log;
+    using std::sin;
+    using std::sqrt;
+    using std::tan;
+    return exp(w * sin(x * log(y) / z) + sqrt(w * z / (x * y))) + w * w / tan(z) - atan2(w, z) + pow(x, 3) / y;
+  }
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(total_degree_variables, T, all_float_types) {
+  using test_constants = test_constants_t<T, 3>;
+  static constexpr auto n = test_constants::order;
+  auto const variables = make_tdtuple<T, n>(2, 3, 5);
+  auto const& x = std::get<0>(variables);
+  auto const& y = std::get<1>(variables);
+  auto const& z = std::get<2>(variables);
+  BOOST_CHECK_EQUAL(x.size, 20u);
+  BOOST_CHECK_EQUAL(x.derivative(0, 0, 0), 2);
+  BOOST_CHECK_EQUAL(y.derivative(0, 0, 0), 3);
+  BOOST_CHECK_EQUAL(z.derivative(0, 0, 0), 5);
+  BOOST_CHECK_EQUAL(x.derivative(1, 0, 0), 1);
+  BOOST_CHECK_EQUAL(x.derivative(0, 1, 0), 0);
+  BOOST_CHECK_EQUAL(y.derivative(0, 1, 0), 1);
+  BOOST_CHECK_EQUAL(z.derivative(0, 0, 1), 1);
+  BOOST_CHECK_THROW(x.derivative(2, 1, 1), std::out_of_range);
+  BOOST_CHECK_THROW((make_tdvar<T, 3, n>(2, 3)), std::out_of_range);
+  BOOST_CHECK_THROW((make_tdvar<T, 2, 2>(2, 2)), std::out_of_range);
+  BOOST_CHECK_THROW((make_tdvar<T, 2, 0>(2, 2)), std::out_of_range);
+  // Polynomials of total degree <= n are exact.
+  auto const p = x * x * y + 3 * x * z - y * z * z + 7;
+  BOOST_CHECK_EQUAL(p.derivative(0, 0, 0), 2 * 2 * 3 + 3 * 2 * 5 - 3 * 5 * 5 + 7);
+  BOOST_CHECK_EQUAL(p.derivative(1, 0, 0), 2 * 2 * 3 + 3 * 5);
+  BOOST_CHECK_EQUAL(p.derivative(0, 1, 0), 2 * 2 - 5 * 5);
+  BOOST_CHECK_EQUAL(p.derivative(0, 0, 1), 3 * 2 - 2 * 3 * 5);
+  BOOST_CHECK_EQUAL(p.derivative(2, 1, 0), 2);
+  BOOST_CHECK_EQUAL(p.derivative(1, 0, 1), 3);
+  BOOST_CHECK_EQUAL(p.derivative(0, 1, 2), -2);
+  BOOST_CHECK_EQUAL(p.derivative(0, 2, 0), 0);
+  BOOST_CHECK_EQUAL(p.derivative(3, 0, 0), 0);
+  // Division inverts multiplication.
+  auto q = p;
+  q *= x + y;
+  q /= x + y;
+  for (std::size_t i = 0; i < q.size; ++i)
+    BOOST_CHECK_CLOSE(q[i], p[i], test_constants::pct_epsilon());
+  q *= q;
+  BOOST_CHECK_EQUAL(q.derivative(0, 0, 0), p.derivative(0, 0, 0) * p.derivative(0, 0, 0));
+  BOOST_CHECK_CLOSE(q.derivative(1, 0, 0), 2 * p.derivative(0, 0, 0) * p.derivative(1, 0, 0),
+                    test_constants::pct_epsilon());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(total_degree_matches_nested_fvar, T, bin_float_types) {
+  using test_constants = test_constants_t<T, 3>;
+  static constexpr auto n = test_constants::order;
+  auto const tdvars = make_tdtuple<T, n>(11, 12, 13, 14);
+  auto const fvars = make_ftuple<T, n, n, n, n>(11, 12, 13, 14);
+  auto const v = boost::mp11::tuple_apply(total_degree_test_function{}, tdvars);
+  auto const u = boost::mp11::tuple_apply(total_degree_test_function{}, fvars);
+  BOOST_CHECK_EQUAL(v.size, 35u);
+  for (std::size_t iw = 0; iw <= n; ++iw)
+    for (std::size_t ix = 0; iw + ix <= n; ++ix)
+      for (std::size_t iy = 0; iw + ix + iy <= n; ++iy)
+        for (std::size_t iz = 0; iw + ix + iy + iz <= n; ++iz)
+          BOOST_CHECK_CLOSE(v.derivative(iw, ix, iy, iz), u.derivative(iw, ix, iy, iz),
+                            1e3 * test_constants::pct_epsilon());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(total_degree_comparisons_and_rounding, T, all_float_types) {
+  using test_constants = test_constants_t<T, 3>;
+  static constexpr auto n = test_constants::order;
+  T const x0 = 2.5;
+  T const y0 = 1.5;
+  auto const tdvars = make_tdtuple<T, n>(x0, y0);
+  auto const& x = std::get<0>(tdvars);
+  auto const& y = std::get<1>(tdvars);
+  BOOST_CHECK(x == x0 && x0 == x && x != y && y < x && 2 < x && y <= y0 && x0 >= x && x > 2);
+  BOOST_CHECK(!(x < x0) && !(y > x));
+  for (auto const& r : {ceil(x), floor(x), round(y), trunc(y)}) {
+    BOOST_CHECK_EQUAL(r.derivative(0, 0), static_cast<T>(static_cast<int>(r.derivative(0, 0))));
+    for (std::size_t i = 1; i < r.size; ++i)
+      BOOST_CHECK_EQUAL(r[i], 0);
+  }
+  BOOST_CHECK_EQUAL(ceil(x).derivative(0, 0), 3);
+  BOOST_CHECK_EQUAL(floor(x).derivative(0, 0), 2);
+  BOOST_CHECK_EQUAL(trunc(-y).derivative(0, 0), -1);
+  BOOST_CHECK_EQUAL(fabs(x - x0).derivative(1, 0), 0);
+  auto const fvars = make_ftuple<T, n, n>(x0, y0);
+  auto const& fx = std::get<0>(fvars);
+  auto const& fy = std::get<1>(fvars);
+  auto const v = pow(T(2), x) * pow(y, T(1.5)) / pow(x, y);
+  auto const u = pow(T(2), fx) * pow(fy, T(1.5)) / pow(fx, fy);
+  for (std::size_t ix = 0; ix <= n; ++ix)
+    for (std::size_t iy = 0; ix + iy <= n; ++iy)
+      BOOST_CHECK_CLOSE(v.derivative(ix, iy), u.derivative(ix, iy), 1e3 * test_constants::pct_epsilon());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
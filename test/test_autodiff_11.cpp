@@ -0,0 +1,145 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_11)
+
+// The products and quotients of 1/(c-x), 1/(d-x) and 1/(d+x) at Order 255, which the subquadratic kernels of
+// detail/autodiff_series.hpp compute for multiprecision types, against their partial fractions.
+BOOST_AUTO_TEST_CASE_TEMPLATE(series_high_order, T, all_float_types) {
+  using std::pow;
+  using test_constants = test_constants_t<T, 255>;
+  static constexpr auto m = test_constants::order;
+  T const c = 1.25;
+  T const d = 1.5;
+  auto const x = make_fvar<T, m>(0);
+  auto const a = 1 / (c - x);
+  auto const b = 1 / (d - x);
+  auto const e = 1 / (d + x);
+  auto const ab = a * b;
+  auto const ae = a * e;
+  auto const q = a / b;
+  auto p = a;
+  p *= e;
+  auto r = a;
+  r /= b;
+  for (auto k : boost::irange(m + 1)) {
+    T const ak = pow(c, -static_cast<int>(k + 1));
+    T const dk = pow(d, -static_cast<int>(k + 1));
+    BOOST_CHECK_CLOSE(a[k], ak, 1e3 * test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(ab[k], (ak - dk) / (d - c), 1e3 * test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(ae[k], (ak + (k % 2 ? -dk : dk)) / (c + d), 1e3 * test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(p[k], ae[k], 1e3 * test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(q[k], k ? (d - c) * ak : d / c, 1e3 * test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(r[k], q[k], 1e3 * test_constants::pct_epsilon());
+  }
+}
+
+// Order + 1 reaches BOOST_AUTODIFF_FFT_THRESHOLD, so double takes the FFT. Its error is relative to the largest
+// coefficient, so 1/(1-x) keeps them all 1, and the coefficients of 1/(2-x) and 1/(2+x) are exact.
+BOOST_AUTO_TEST_CASE(series_fft) {
+  using test_constants = test_constants_t<double, 4095>;
+  static constexpr auto m = test_constants::order;
+  auto const x = make_fvar<double, m>(0);
+  auto const a = 1 / (1 - x);
+  auto const b = 1 / (2 - x);
+  auto const e = 1 / (2 + x);
+  auto const ab = a * b;
+  auto const ae = a * e;
+  auto const q = a / b;
+  auto p = a;
+  p *= e;
+  auto r = a;
+  r /= b;
+  double dk = 1;
+  for (auto k : boost::irange(m + 1)) {
+    dk /= 2;
+    BOOST_CHECK_CLOSE(ab[k], 1 - dk, 1e3 * test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(ae[k], (1 + (k % 2 ? -dk : dk)) / 3, 1e3 * test_constants::pct_epsilon());
+    BOOST_CHECK_EQUAL(p[k], ae[k]);
+    BOOST_CHECK_CLOSE(q[k], k ? 1 : 2, 1e3 * test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(r[k], q[k], 1e3 * test_constants::pct_epsilon());
+  }
+}
+
+#if defined(BOOST_AUTODIFF_TESTING_INCLUDE_MULTIPRECISION)
+// sqrt, log and exp of 1/(c-x) at Order 1023 are computed by Newton iteration, as is the inverse of
+// (c-x)/(d-x). The quotient within log and the product within sqrt cancel, as they do in the quadratic
+// algorithms, so the tolerance grows with Order.
+BOOST_AUTO_TEST_CASE_TEMPLATE(series_newton, T, multiprecision_float_types) {
+  using std::log;
+  using std::pow;
+  using std::sqrt;
+  using test_constants = test_constants_t<T, 1023>;
+  static constexpr auto m = test_constants::order;
+  T const c = 1.25;
+  T const d = 1.5;
+  T const tolerance = (m + 1) * (m + 1) / 16 * test_constants::pct_epsilon();
+  auto const x = make_fvar<T, m>(0);
+  auto const a = 1 / (c - x);
+  auto const s = sqrt(a);
+  auto const l = log(a);
+  auto const e = exp(l);
+  auto const i = ((c - x) / (d - x)).inverse();
+  T sk = 1 / sqrt(c);
+  for (auto k : boost::irange(m + 1)) {
+    T const ak = pow(c, -static_cast<int>(k + 1));
+    if (k)
+      sk *= (2 * k - 1) / (2 * k * c);
+    BOOST_CHECK_CLOSE(s[k], sk, tolerance);
+    BOOST_CHECK_CLOSE(l[k], k ? pow(c, -static_cast<int>(k)) / k : -log(c), tolerance);
+    BOOST_CHECK_CLOSE(e[k], ak, tolerance);
+    BOOST_CHECK_CLOSE(i[k], k ? (d - c) * ak : d / c, tolerance);
+  }
+}
+
+// The coefficients of exp(1+x) and exp(x^2/2) decay faster than geometrically, far below the norm relative to
+// which Newton iteration is accurate, and are each still accurate.
+BOOST_AUTO_TEST_CASE_TEMPLATE(series_exp_polynomial, T, multiprecision_float_types) {
+  using std::exp;
+  using test_constants = test_constants_t<T, 1023>;
+  static constexpr auto m = test_constants::order;
+  auto const x = make_fvar<T, m>(0);
+  auto const e = exp(1 + x);
+  auto const f = exp(x * x / 2);
+  T ek = exp(T(1));
+  T fk = 1;
+  for (auto k : boost::irange(m + 1)) {
+    if (k)
+      ek /= k;
+    if (k && k % 2 == 0)
+      fk /= k;
+    BOOST_CHECK_CLOSE(e[k], ek, 1e3 * test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(f[k], k % 2 ? 0 : fk, 1e3 * test_constants::pct_epsilon());
+  }
+}
+#endif
+
+// With the FFT products of double at Order 4095, sqrt(1/(1-x)) is the binomial series of -1/2, log(1/(1-x))
+// that of -log(1-x), and exp of that log gives back 1/(1-x). The inverse of (1-x)/(2-x) is 1 + x/(1-x).
+BOOST_AUTO_TEST_CASE(series_newton_fft) {
+  using std::sqrt;
+  using test_constants = test_constants_t<double, 4095>;
+  static constexpr auto m = test_constants::order;
+  double const tolerance = (m + 1) * (m + 1) / 16 * test_constants::pct_epsilon();
+  auto const x = make_fvar<double, m>(0);
+  auto const a = 1 / (1 - x);
+  auto const s = sqrt(a);
+  auto const l = log(a);
+  auto const e = exp(l);
+  auto const i = ((1 - x) / (2 - x)).inverse();
+  double sk = 1;
+  for (auto k : boost::irange(m + 1)) {
+    if (k)
+      sk *= (2 * k - 1) / (2.0 * k);
+    BOOST_CHECK_CLOSE(s[k], sk, tolerance);
+    BOOST_CHECK_CLOSE(l[k], k ? 1.0 / k : 0, tolerance);
+    BOOST_CHECK_CLOSE(e[k], 1, tolerance);
+    BOOST_CHECK_CLOSE(i[k], k ? 1 : 2, tolerance);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
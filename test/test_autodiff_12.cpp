@@ -0,0 +1,58 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_12)
+
+// fvar arithmetic is constexpr as of C++17. float and double select the SIMD kernels of
+// detail/autodiff_simd.hpp at run time, which are only bypassed when the compiler can detect constant
+// evaluation. Otherwise the same checks are made at run time.
+#if !defined(BOOST_NO_CXX17_IF_CONSTEXPR) && defined(BOOST_AUTODIFF_HAS_IS_CONSTANT_EVALUATED)
+#define TEST_AUTODIFF_CONSTEXPR constexpr
+#define TEST_AUTODIFF_CONSTEXPR_CHECK(expr) static_assert(expr, #expr)
+#else
+#define TEST_AUTODIFF_CONSTEXPR
+#define TEST_AUTODIFF_CONSTEXPR_CHECK(expr) BOOST_CHECK(expr)
+#endif
+
+template <typename T, size_t m>
+TEST_AUTODIFF_CONSTEXPR autodiff_fvar<T, m, m> constexpr_function(T const& cx, T const& cy) {
+  auto const x = make_fvar<T, m>(cx);
+  auto const y = make_fvar<T, 0, m>(cy);
+  autodiff_fvar<T, m, m> z = (x * x * x + 2 * x - x / (1 + x)) * y / (y - 1);
+  z -= 3 / (x + y);
+  z *= -x;
+  z /= y * y;
+  z += 1;
+  return z;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(constexpr_arithmetic, T, bin_float_types) {
+  constexpr std::size_t m = 3;
+  TEST_AUTODIFF_CONSTEXPR auto const x = make_fvar<T, m>(2);
+  TEST_AUTODIFF_CONSTEXPR auto const cube = x * x * x;
+  TEST_AUTODIFF_CONSTEXPR_CHECK(cube.derivative(0) == 8);
+  TEST_AUTODIFF_CONSTEXPR_CHECK(cube.derivative(1) == 12);
+  TEST_AUTODIFF_CONSTEXPR_CHECK(cube.derivative(2) == 12);
+  TEST_AUTODIFF_CONSTEXPR_CHECK(cube.derivative(3) == 6);
+  TEST_AUTODIFF_CONSTEXPR auto const inverse = 1 / x;
+  TEST_AUTODIFF_CONSTEXPR_CHECK(inverse.derivative(0) == T(0.5));
+  TEST_AUTODIFF_CONSTEXPR_CHECK(inverse.derivative(1) == T(-0.25));
+  TEST_AUTODIFF_CONSTEXPR_CHECK(inverse.derivative(2) == T(0.25));
+  TEST_AUTODIFF_CONSTEXPR_CHECK(inverse.derivative(3) == T(-0.375));
+  TEST_AUTODIFF_CONSTEXPR auto const difference = (x - 1) * (x + 1) - x * x;
+  TEST_AUTODIFF_CONSTEXPR_CHECK(difference.derivative(0) == -1 && difference.derivative(1) == 0);
+  TEST_AUTODIFF_CONSTEXPR_CHECK(-x < 0 && +x == 2 && x != 1 && 1 <= x && x > 1);
+
+  TEST_AUTODIFF_CONSTEXPR auto const z = constexpr_function<T, m>(2, 3);
+  auto const runtime_z = constexpr_function<T, m>(2, 3);
+  T const tolerance = 10 * test_constants_t<T, m>::pct_epsilon();
+  for (auto i : boost::irange(m + 1))
+    for (auto j : boost::irange(m + 1))
+      BOOST_CHECK_CLOSE(z.derivative(i, j), runtime_z.derivative(i, j), tolerance);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
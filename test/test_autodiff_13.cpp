@@ -0,0 +1,60 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_13)
+
+// fma() and add_product() convolve into the coefficients of the result, which must equal a*b+c.
+BOOST_AUTO_TEST_CASE_TEMPLATE(fma_add_product, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  static constexpr auto m = test_constants::order;
+  T const eps = 1e2 * test_constants::pct_epsilon();
+  auto const x = make_fvar<T, m>(0.5);
+  auto const a = exp(x);
+  auto const b = sin(x) + x;
+  auto const c = log(x + 2);
+  auto const r = a * b + c;
+  auto const f = fma(a, b, c);
+  auto const fa = fma(a, T(3), c);
+  auto const af = fma(T(3), a, c);
+  auto acc = c;
+  acc.add_product(a, b);
+  acc.add_product(T(3), a);
+  auto self = a;
+  self.add_product(self, b);
+  for (auto i : boost::irange(m + 1)) {
+    BOOST_CHECK_CLOSE(f.derivative(i), r.derivative(i), eps);
+    BOOST_CHECK_CLOSE(fa.derivative(i), (a * 3 + c).derivative(i), eps);
+    BOOST_CHECK_EQUAL(af.derivative(i), fa.derivative(i));
+    BOOST_CHECK_CLOSE(acc.derivative(i), (r + 3 * a).derivative(i), eps);
+    BOOST_CHECK_CLOSE(self.derivative(i), (a + a * b).derivative(i), eps);
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(fma_mixed_partials, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  static constexpr auto m = test_constants::order;
+  T const eps = 1e2 * test_constants::pct_epsilon();
+  auto const x = make_fvar<T, m>(0.5);
+  auto const y = make_fvar<T, 0, m>(1.5);
+  auto const a = x * cos(y);
+  auto const b = exp(x * y);
+  auto const c = y - x;
+  auto const r = a * b + c;
+  auto const f = fma(a, b, c);
+  auto acc = c;
+  acc.add_product(a, b);
+  auto const g = boost::math::fma(a, b, c);
+  for (auto i : boost::irange(m + 1)) {
+    for (auto j : boost::irange(m + 1)) {
+      BOOST_CHECK_CLOSE(f.derivative(i, j), r.derivative(i, j), eps);
+      BOOST_CHECK_EQUAL(acc.derivative(i, j), f.derivative(i, j));
+      BOOST_CHECK_EQUAL(g.derivative(i, j), f.derivative(i, j));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,45 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_14)
+
+// Functions of an fvar whose RealType is not a nested fvar are composed by detail::series::compose() and
+// compose_powers(), with a separate path for a linear epsilon. Those of fvar<fvar<T,m>,0> are composed by the
+// generic Horner steps, so the two must agree.
+BOOST_AUTO_TEST_CASE_TEMPLATE(compose_identities, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  static constexpr auto m = test_constants::order;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  auto const x = make_fvar<T, m>(0.25);
+  auto const g = x * x + sin(x) / 3;  // Nonlinear epsilon.
+  auto const h = x / 2 + 1;           // Linear epsilon.
+  auto const one = sin(g) * sin(g) + cos(g) * cos(g);
+  auto const g1 = exp(log(g + 1)) - 1;
+  auto const g2 = sqrt(g + 1) * sqrt(g + 1) - 1;
+  auto const g3 = tan(atan(g));
+  auto const h1 = exp(log(h)) + sqrt(h) * sqrt(h) - atan(tan(h));
+  auto const y = make_fvar<T, 0, m>(0.25);
+  auto const gy = y * y + sin(y) / 3;
+  auto const r = exp(g) + log(g) + atan(g) + asin(g) + erf(g);
+  auto const ry = exp(gy) + log(gy) + atan(gy) + asin(gy) + erf(gy);
+  BOOST_CHECK_CLOSE(one.derivative(0), T(1), eps);
+  BOOST_CHECK_CLOSE(h1.derivative(0), h.derivative(0), eps);
+  BOOST_CHECK_CLOSE(h1.derivative(1), h.derivative(1), eps);
+  for (auto i : boost::irange(m + 1)) {
+    if (i) {
+      BOOST_CHECK_SMALL(one.derivative(i), eps);
+      if (1 < i)
+        BOOST_CHECK_SMALL(h1.derivative(i), eps);
+    }
+    BOOST_CHECK_CLOSE(g1.derivative(i), g.derivative(i), eps);
+    BOOST_CHECK_CLOSE(g2.derivative(i), g.derivative(i), eps);
+    BOOST_CHECK_CLOSE(g3.derivative(i), g.derivative(i), eps);
+    BOOST_CHECK_CLOSE(r.derivative(i), ry.derivative(0, i), eps);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
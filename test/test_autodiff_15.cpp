@@ -0,0 +1,51 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_15)
+
+// The factorial, inverse factorial and binomial tables must agree with Boost.Math, including for indices
+// beyond the size of the table, which are calculated on demand.
+BOOST_AUTO_TEST_CASE_TEMPLATE(factorial_binomial_tables, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  constexpr std::size_t n = 20;
+  T const eps = 10 * test_constants::pct_epsilon();
+  for (auto i : boost::irange(n + 3)) {
+    unsigned const u = static_cast<unsigned>(i);
+    BOOST_CHECK_EQUAL((detail::factorial<T, n>(u)), boost::math::factorial<T>(u));
+    BOOST_CHECK_CLOSE((detail::inverse_factorial<T, n>(u)), 1 / boost::math::factorial<T>(u), eps);
+  }
+  for (auto i : boost::irange(n + 1))
+    for (auto k : boost::irange(i + 1))
+      BOOST_CHECK_EQUAL(
+          (detail::binomial<T, n>(i, k)),
+          boost::math::binomial_coefficient<T>(static_cast<unsigned>(i), static_cast<unsigned>(k)));
+}
+
+// derivative() and pow(fvar,fvar) read the tables; compare against closed forms of x^y at x=2, y=3.
+BOOST_AUTO_TEST_CASE_TEMPLATE(factorial_binomial_derivatives, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  static constexpr auto m = test_constants::order;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  auto const x = make_fvar<T, m>(2);
+  auto const y = make_fvar<T, 0, m>(3);
+  auto const z = pow(x, y);
+  T const log2 = log(T(2));
+  T dx = 8;  // d^i/dx^i x^3
+  for (auto i : boost::irange(m + 1)) {
+    T dy = dx;  // d^j/dy^j 2^y = 8 (log 2)^j when i = 0
+    for (auto j : boost::irange(m + 1)) {
+      if (i == 0)
+        BOOST_CHECK_CLOSE(z.derivative(i, j), dy, eps);
+      else if (j == 0)
+        BOOST_CHECK_CLOSE(z.derivative(i, j), dx, eps);
+      dy *= log2;
+    }
+    dx = i < 3 ? dx * (3 - static_cast<int>(i)) / 2 : T(0);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
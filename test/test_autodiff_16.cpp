@@ -0,0 +1,54 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_16)
+
+// exp, log, pow and sqrt of an fvar whose RealType is not a nested fvar are computed by the recurrences of
+// detail::series. Those of fvar<fvar<T,0>,m> compose their derivatives as before, so the two must agree.
+BOOST_AUTO_TEST_CASE_TEMPLATE(recurrences, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  static constexpr auto m = test_constants::order;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  auto const x = make_fvar<T, m>(0.25);
+  auto const y = make_fvar<T, 0, m>(0.25);
+  auto const gx = x * x + sin(x) / 3 + 1;  // Nonlinear epsilon.
+  auto const gy = y * y + sin(y) / 3 + 1;
+  auto const hx = 2 - x / 2;  // Linear epsilon.
+  auto const hy = 2 - y / 2;
+  auto const rx = exp(gx) + log(gx) + pow(gx, T(2.5)) + pow(T(3), gx) + sqrt(gx);
+  auto const ry = exp(gy) + log(gy) + pow(gy, T(2.5)) + pow(T(3), gy) + sqrt(gy);
+  auto const sx = exp(hx) + log(hx) + pow(hx, T(-1.5)) + pow(T(0.5), hx) + sqrt(hx);
+  auto const sy = exp(hy) + log(hy) + pow(hy, T(-1.5)) + pow(T(0.5), hy) + sqrt(hy);
+  auto const nx = pow(-gx, T(-3));  // Negative base, integral exponent.
+  auto const ny = pow(-gy, T(-3));
+  for (auto i : boost::irange(m + 1)) {
+    BOOST_CHECK_CLOSE(rx.derivative(i), ry.derivative(0, i), eps);
+    BOOST_CHECK_CLOSE(sx.derivative(i), sy.derivative(0, i), eps);
+    BOOST_CHECK_CLOSE(nx.derivative(i), ny.derivative(0, i), eps);
+  }
+}
+
+// Integral powers of an independent variable have exactly zero derivatives above the exponent, root values
+// of 0 take the previous paths, and an overflowing exp() has infinite rather than NaN derivatives.
+BOOST_AUTO_TEST_CASE_TEMPLATE(recurrence_edge_cases, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  static constexpr auto m = test_constants::order;
+  auto const x = make_fvar<T, m>(-1.5);
+  auto const x3 = pow(x, T(3));
+  for (auto i : boost::irange(std::size_t(4), m + 1))
+    BOOST_CHECK_EQUAL(x3.derivative(i), T(0));
+  auto const z = make_fvar<T, m>(0);
+  BOOST_CHECK_EQUAL(sqrt(z).derivative(0), T(0));
+  BOOST_CHECK(isinf(sqrt(z).derivative(1)));
+  BOOST_CHECK(isinf(log(z).derivative(0)));
+  auto const big = exp(make_fvar<T, m>(2 * log((std::numeric_limits<T>::max)())));
+  BOOST_CHECK(isinf(big.derivative(0)));
+  for (auto i : boost::irange(m + 1))
+    BOOST_CHECK(!isnan(big.derivative(i)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,52 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_17)
+
+// The trigonometric and hyperbolic functions of an fvar whose RealType is not a nested fvar are computed by
+// the coupled recurrences of detail::series. Those of fvar<fvar<T,0>,m> compose their derivatives as before.
+BOOST_AUTO_TEST_CASE_TEMPLATE(trig_recurrences, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  static constexpr auto m = test_constants::order;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  auto const x = make_fvar<T, m>(0.25);
+  auto const y = make_fvar<T, 0, m>(0.25);
+  auto const gx = x * x + exp(x) / 3;  // Nonlinear epsilon.
+  auto const gy = y * y + exp(y) / 3;
+  auto const hx = 2 - x / 2;  // Linear epsilon.
+  auto const hy = 2 - y / 2;
+  auto const rx = sin(gx) + 2 * cos(gx) + 3 * tan(gx) + 4 * sinh(gx) + 5 * cosh(gx) + 6 * tanh(gx);
+  auto const ry = sin(gy) + 2 * cos(gy) + 3 * tan(gy) + 4 * sinh(gy) + 5 * cosh(gy) + 6 * tanh(gy);
+  auto const sx = sin(hx) + 2 * cos(hx) + 3 * tan(hx) + 4 * sinh(hx) + 5 * cosh(hx) + 6 * tanh(hx);
+  auto const sy = sin(hy) + 2 * cos(hy) + 3 * tan(hy) + 4 * sinh(hy) + 5 * cosh(hy) + 6 * tanh(hy);
+  for (auto i : boost::irange(m + 1)) {
+    BOOST_CHECK_CLOSE(rx.derivative(i), ry.derivative(0, i), eps);
+    BOOST_CHECK_CLOSE(sx.derivative(i), sy.derivative(0, i), eps);
+  }
+}
+
+// sincos() and sinhcosh() return the same coefficients as the separate functions, for nested fvar as well.
+BOOST_AUTO_TEST_CASE_TEMPLATE(sincos_sinhcosh, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  static constexpr auto m = test_constants::order;
+  auto const x = make_fvar<T, m>(0.75);
+  auto const g = x * x - x / 3;
+  auto const sc = sincos(g);
+  auto const shch = sinhcosh(g);
+  auto const y = make_fvar<T, m, m>(0.75);
+  auto const sc2 = sincos(y * y);
+  for (auto i : boost::irange(m + 1)) {
+    BOOST_CHECK_EQUAL(sc.first.derivative(i), sin(g).derivative(i));
+    BOOST_CHECK_EQUAL(sc.second.derivative(i), cos(g).derivative(i));
+    BOOST_CHECK_EQUAL(shch.first.derivative(i), sinh(g).derivative(i));
+    BOOST_CHECK_EQUAL(shch.second.derivative(i), cosh(g).derivative(i));
+    BOOST_CHECK_EQUAL(sc2.first.derivative(i, 0), sin(y * y).derivative(i, 0));
+    BOOST_CHECK_EQUAL(sc2.second.derivative(0, i), cos(y * y).derivative(0, i));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
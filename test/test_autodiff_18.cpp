@@ -0,0 +1,59 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_18)
+
+// The inverse trigonometric and hyperbolic functions, atan2 and erf of an fvar whose RealType is not a nested
+// fvar integrate their derivatives by the recurrences of detail::series. Those of fvar<fvar<T,0>,m> compose
+// their derivatives as before.
+BOOST_AUTO_TEST_CASE_TEMPLATE(inverse_recurrences, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  static constexpr auto m = test_constants::order;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  auto const f = [](auto const& g) {
+    return asin(g) + 2 * acos(g) + 3 * atan(g) + 4 * asinh(g) + 5 * acosh(g + 2) + 6 * atanh(g) + 7 * erf(g) +
+           8 * erfc(g);
+  };
+  auto const x = make_fvar<T, m>(0.25);
+  auto const y = make_fvar<T, 0, m>(0.25);
+  auto const gx = x * x / 2 + sin(x) / 3;  // Nonlinear epsilon.
+  auto const gy = y * y / 2 + sin(y) / 3;
+  auto const hx = 1 - x / 2;  // Linear epsilon.
+  auto const hy = 1 - y / 2;
+  auto const rx = f(gx);
+  auto const ry = f(gy);
+  auto const sx = f(hx - 1 / T(2));
+  auto const sy = f(hy - 1 / T(2));
+  for (auto i : boost::irange(m + 1)) {
+    BOOST_CHECK_CLOSE(rx.derivative(i), ry.derivative(0, i), eps);
+    BOOST_CHECK_CLOSE(sx.derivative(i), sy.derivative(0, i), eps);
+  }
+}
+
+// atan2(fvar, fvar) divides by whichever argument has the larger root. atan2(g, g) is constant.
+BOOST_AUTO_TEST_CASE_TEMPLATE(atan2_recurrences, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  static constexpr auto m = test_constants::order;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  auto const f = [](auto const& g, auto const& h) {
+    return atan2(g, h) + 2 * atan2(h, g) + 3 * atan2(-g, T(0.5)) + 4 * atan2(T(-0.5), h) + 5 * atan2(T(0), g);
+  };
+  auto const x = make_fvar<T, m>(0.25);
+  auto const y = make_fvar<T, 0, m>(0.25);
+  auto const rx = f(x * x + sin(x) / 3, 2 - x / 2);
+  auto const ry = f(y * y + sin(y) / 3, 2 - y / 2);
+  auto const g = x * x + sin(x) / 3;
+  auto const c = atan2(g, g);
+  BOOST_CHECK_CLOSE(c.derivative(0), boost::math::constants::pi<T>() / 4, eps);
+  for (auto i : boost::irange(m + 1)) {
+    BOOST_CHECK_CLOSE(rx.derivative(i), ry.derivative(0, i), eps);
+    if (i)
+      BOOST_CHECK_SMALL(c.derivative(i), eps);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
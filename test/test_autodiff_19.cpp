@@ -0,0 +1,51 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_19)
+
+// Functions of a nested fvar compose only the terms of each Horner step or power of epsilon that contribute to
+// the result. f(x+y) and f(x+y+z) have the mixed partial derivatives of f(t) of order i+j and i+j+k, which
+// are of total degree up to order_sum.
+BOOST_AUTO_TEST_CASE_TEMPLATE(nested_composition, T, all_float_types) {
+  using test_constants = test_constants_t<T, 3>;
+  static constexpr auto m = test_constants::order;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  auto const f = [](auto const& g) {
+    return exp(g) + log(g) + sqrt(g) + sin(g) + tan(g) + atan(g) + asin(g / 2) + erf(g) + 1 / g;
+  };
+  auto const xy = make_ftuple<T, m, m>(0.25, 0.5);
+  auto const xyz = make_ftuple<T, m, m, m>(0.25, 0.5, 0.125);
+  auto const r2 = f(std::get<0>(xy) + std::get<1>(xy));
+  auto const r3 = f(std::get<0>(xyz) + std::get<1>(xyz) + std::get<2>(xyz));
+  auto const s2 = f(make_fvar<T, 2 * m>(0.75));
+  auto const s3 = f(make_fvar<T, 3 * m>(0.875));
+  for (auto i : boost::irange(m + 1))
+    for (auto j : boost::irange(m + 1)) {
+      BOOST_CHECK_CLOSE(r2.derivative(i, j), s2.derivative(i + j), eps);
+      for (auto k : boost::irange(m + 1))
+        BOOST_CHECK_CLOSE(r3.derivative(i, j, k), s3.derivative(i + j + k), eps);
+    }
+}
+
+// Terms of epsilon^i below degree i are not multiplied by infinite coefficients, such as those of sqrt() at 0.
+BOOST_AUTO_TEST_CASE_TEMPLATE(nested_infinite_coefficients, T, all_float_types) {
+  using test_constants = test_constants_t<T, 3>;
+  static constexpr auto m = test_constants::order;
+  auto const xy = make_ftuple<T, m, m>(0, 0.5);
+  auto const r = sqrt(std::get<0>(xy) * std::get<1>(xy));
+  auto const s = sqrt(make_fvar<T, m>(0));
+  for (auto i : boost::irange(m + 1))
+    for (auto j : boost::irange(m + 1)) {
+      BOOST_CHECK(!(boost::math::isnan)(r.derivative(i, j)));
+      if (i == 0)
+        BOOST_CHECK_EQUAL(r.derivative(i, j), T(0));
+      else if (j == 0)
+        BOOST_CHECK_EQUAL(r.derivative(i, j), s.derivative(i));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,41 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_20)
+
+// exp(g) and 1/(2-g) by apply_derivatives() and apply_coefficients() on either side of
+// BOOST_AUTODIFF_COMPOSE_THRESHOLD, from which they compose by baby steps and giant steps instead of Horner's
+// method, against exp() and the quotient of the series.
+BOOST_AUTO_TEST_CASE_TEMPLATE(compose_blocked, T, all_float_types) {
+  using std::exp;
+  using std::pow;
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  mp11::mp_for_each<mp11::mp_list_c<size_t,
+                                    5,
+                                    BOOST_AUTODIFF_COMPOSE_THRESHOLD - 2,
+                                    BOOST_AUTODIFF_COMPOSE_THRESHOLD - 1,
+                                    2 * BOOST_AUTODIFF_COMPOSE_THRESHOLD,
+                                    3 * BOOST_AUTODIFF_COMPOSE_THRESHOLD + 7>>([&](auto order) {
+    constexpr size_t m = decltype(order)::value;
+    auto const x = make_fvar<T, m>(0.5);
+    auto const g = x * x / 4 + x / 2;
+    T const g0 = static_cast<T>(g);
+    auto const y = g.apply_derivatives(m, [&g0](size_t) { return exp(g0); });
+    auto const z =
+        g.apply_coefficients(m, [&g0](size_t i) { return 1 / pow(2 - g0, static_cast<int>(i + 1)); });
+    auto const ey = exp(g);
+    auto const ez = 1 / (2 - g);
+    for (auto i : boost::irange(m + 1)) {
+      if ((std::numeric_limits<T>::min)() < ey[i])  // Those of exp(g) underflow float at high Order.
+        BOOST_CHECK_CLOSE(y[i], ey[i], eps);
+      BOOST_CHECK_CLOSE(z[i], ez[i], eps);
+    }
+  });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,53 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_21)
+
+// f(x0) and f'(x0) of the functions of a dual number, which compute them directly, against the first two
+// derivatives of the same functions of Order 2, which take the recurrences.
+BOOST_AUTO_TEST_CASE_TEMPLATE(dual_functions, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e2 * test_constants::pct_epsilon();
+  T const c = 1.25;
+  auto const x1 = make_fvar<T, 1>(0.375);
+  auto const x2 = make_fvar<T, 2>(0.375);
+  auto const c1 = make_fvar<T, 1>(c);  // acosh is defined from 1.
+  auto const c2 = make_fvar<T, 2>(c);
+  auto const f = [](size_t i) { return T(i + 2); };
+  check_derivatives_close(exp(x1), exp(x2), 1, eps);
+  check_derivatives_close(pow(x1, c), pow(x2, c), 1, eps);
+  check_derivatives_close(pow(c, x1), pow(c, x2), 1, eps);
+  check_derivatives_close(sqrt(x1), sqrt(x2), 1, eps);
+  check_derivatives_close(log(x1), log(x2), 1, eps);
+  check_derivatives_close(tan(x1), tan(x2), 1, eps);
+  check_derivatives_close(tanh(x1), tanh(x2), 1, eps);
+  check_derivatives_close(asin(x1), asin(x2), 1, eps);
+  check_derivatives_close(acos(x1), acos(x2), 1, eps);
+  check_derivatives_close(atan(x1), atan(x2), 1, eps);
+  check_derivatives_close(atan2(x1, c), atan2(x2, c), 1, eps);
+  check_derivatives_close(atan2(c, x1), atan2(c, x2), 1, eps);
+  check_derivatives_close(asinh(x1), asinh(x2), 1, eps);
+  check_derivatives_close(acosh(c1), acosh(c2), 1, eps);
+  check_derivatives_close(atanh(x1), atanh(x2), 1, eps);
+  check_derivatives_close(erf(x1), erf(x2), 1, eps);
+  check_derivatives_close(erfc(x1), erfc(x2), 1, eps);
+  check_derivatives_close(x1.apply_derivatives(1, f), x2.apply_derivatives(1, f), 1, eps);
+  check_derivatives_close(x1.apply_coefficients(1, f), x2.apply_coefficients(1, f), 1, eps);
+}
+
+// apply_derivatives() and apply_coefficients() of order 0 leave only the root of a dual number.
+BOOST_AUTO_TEST_CASE_TEMPLATE(dual_apply_order_0, T, all_float_types) {
+  auto const x = make_fvar<T, 1>(2);
+  auto const y = x.apply_derivatives(0, [](size_t i) { return T(i + 3); });
+  auto const z = x.apply_coefficients(0, [](size_t i) { return T(i + 3); });
+  BOOST_CHECK_EQUAL(y.derivative(0), T(3));
+  BOOST_CHECK_EQUAL(y.derivative(1), T(0));
+  BOOST_CHECK_EQUAL(z.derivative(0), T(3));
+  BOOST_CHECK_EQUAL(z.derivative(1), T(0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
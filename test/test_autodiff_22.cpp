@@ -0,0 +1,68 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_22)
+
+// f(x0), f'(x0) and f''(x0)/2 of the functions of Order 2, which are in closed form up to
+// BOOST_AUTODIFF_CLOSED_FORM_ORDER, against the first three derivatives of the same functions of Order 3,
+// which take the recurrences. The argument has a nonzero e^2 term, as after a product.
+BOOST_AUTO_TEST_CASE_TEMPLATE(order_2_functions, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e2 * test_constants::pct_epsilon();
+  T const x0 = 0.375;
+  T const c = 1.25;
+  auto const x2 = make_fvar<T, 2>(x0);
+  auto const x3 = make_fvar<T, 3>(x0);
+  auto const a2 = x2 + x2 * x2 / 8 - x0 * x0 / 8;
+  auto const a3 = x3 + x3 * x3 / 8 - x0 * x0 / 8;
+  check_derivatives_close(exp(a2), exp(a3), 2, eps);
+  check_derivatives_close(pow(a2, c), pow(a3, c), 2, eps);
+  check_derivatives_close(pow(c, a2), pow(c, a3), 2, eps);
+  check_derivatives_close(sqrt(a2), sqrt(a3), 2, eps);
+  check_derivatives_close(log(a2), log(a3), 2, eps);
+  check_derivatives_close(sin(a2), sin(a3), 2, eps);
+  check_derivatives_close(cos(a2), cos(a3), 2, eps);
+  check_derivatives_close(tan(a2), tan(a3), 2, eps);
+  check_derivatives_close(sinh(a2), sinh(a3), 2, eps);
+  check_derivatives_close(cosh(a2), cosh(a3), 2, eps);
+  check_derivatives_close(tanh(a2), tanh(a3), 2, eps);
+  check_derivatives_close(asin(a2), asin(a3), 2, eps);
+  check_derivatives_close(acos(a2), acos(a3), 2, eps);
+  check_derivatives_close(atan(a2), atan(a3), 2, eps);
+  check_derivatives_close(atan2(a2, c), atan2(a3, c), 2, eps);
+  check_derivatives_close(atan2(c, a2), atan2(c, a3), 2, eps);
+  check_derivatives_close(asinh(a2), asinh(a3), 2, eps);
+  check_derivatives_close(acosh(c + a2), acosh(c + a3), 2, eps);
+  check_derivatives_close(atanh(a2), atanh(a3), 2, eps);
+  check_derivatives_close(erf(a2), erf(a3), 2, eps);
+  check_derivatives_close(erfc(a2), erfc(a3), 2, eps);
+  auto const f = [](size_t i) { return T(i + 2); };
+  for (auto order : boost::irange(4)) {
+    check_derivatives_close(a2.apply_derivatives(order, f), a3.apply_derivatives(order, f), 2, eps);
+    check_derivatives_close(a2.apply_coefficients(order, f), a3.apply_coefficients(order, f), 2, eps);
+  }
+}
+
+// The products and quotients of Order 2 that are written out for float and double, and add_product(), against
+// the same arithmetic in long double.
+BOOST_AUTO_TEST_CASE_TEMPLATE(order_2_arithmetic, T, bin_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e2 * test_constants::pct_epsilon();
+  auto const x = make_fvar<T, 2>(1.5);
+  auto const lx = make_fvar<long double, 2>(1.5);
+  auto const a = x * x / 3 + x;
+  auto const la = lx * lx / 3 + lx;
+  auto p = a * (a + 1);
+  auto lp = la * (la + 1);
+  p.add_product(a, x);
+  lp.add_product(la, lx);
+  check_derivatives_close(p, lp, 2, eps);
+  check_derivatives_close(p / (a - 2) / x, lp / (la - 2) / lx, 2, eps);
+  check_derivatives_close(2 / a, 2 / la, 2, eps);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
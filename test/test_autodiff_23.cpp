@@ -0,0 +1,44 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_23)
+
+// Products and quotients, in place and not, and add_product(), on either side of
+// BOOST_AUTODIFF_UNROLL_THRESHOLD, below which float and double unroll them at compile time and from which
+// they call axpy(), against the same arithmetic in long double.
+BOOST_AUTO_TEST_CASE_TEMPLATE(unrolled_arithmetic, T, bin_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  mp11::mp_for_each<mp11::mp_list_c<size_t,
+                                    0,
+                                    3,
+                                    5,
+                                    BOOST_AUTODIFF_UNROLL_THRESHOLD - 2,
+                                    BOOST_AUTODIFF_UNROLL_THRESHOLD - 1,
+                                    BOOST_AUTODIFF_UNROLL_THRESHOLD + 3>>([&](auto order) {
+    constexpr size_t m = decltype(order)::value;
+    auto const x = make_fvar<T, m>(1.5);
+    auto const lx = make_fvar<long double, m>(1.5);
+    auto const a = x * x / 3 + x;
+    auto const la = lx * lx / 3 + lx;
+    auto p = a * (a + 1);
+    auto lp = la * (la + 1);
+    p *= x;
+    lp *= lx;
+    p.add_product(a, x);
+    lp.add_product(la, lx);
+    auto q = p / (a - 2);
+    auto lq = lp / (la - 2);
+    q /= x;
+    lq /= lx;
+    check_derivatives_close(p, lp, m, eps);
+    check_derivatives_close(q, lq, m, eps);
+    check_derivatives_close(2 / a, 2 / la, m, eps);
+  });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
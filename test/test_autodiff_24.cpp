@@ -0,0 +1,90 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_AUTODIFF_SKIP_ZEROS
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_24)
+
+// With BOOST_AUTODIFF_SKIP_ZEROS, the functions of a constant fvar are constants.
+BOOST_AUTO_TEST_CASE_TEMPLATE(constant_functions, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e2 * test_constants::pct_epsilon();
+  constexpr std::size_t m = 5;
+  T const c0 = 0.375;
+  autodiff_fvar<T, m> const c(c0);
+  auto const x = make_fvar<T, m>(1.5);
+  auto const f = [](std::size_t i) { return T(i + 2); };
+  std::array<autodiff_fvar<T, m>, 11> const y{
+      {exp(c), pow(c, T(1.25)), pow(T(1.25), c), sqrt(c), log(c), sin(c), tan(c), tanh(c), asin(c),
+       c.apply_derivatives(m, f), c.apply_coefficients(m, f)}};
+  std::array<T, 11> const y0{{exp(c0), pow(c0, T(1.25)), pow(T(1.25), c0), sqrt(c0), log(c0), sin(c0),
+                              tan(c0), tanh(c0), asin(c0), T(2), T(2)}};
+  for (auto j : boost::irange(y.size())) {
+    BOOST_CHECK_CLOSE(y[j].derivative(0), y0[j], eps);
+    for (auto i : boost::irange(std::size_t(1), m + 1))
+      BOOST_CHECK_EQUAL(y[j].derivative(i), 0);
+  }
+  auto const p = x * c;
+  auto const q = x / c;
+  auto const r = c0 / (c + 0);
+  for (auto i : boost::irange(m + 1)) {
+    BOOST_CHECK_CLOSE(p.derivative(i), (x * c0).derivative(i), eps);
+    BOOST_CHECK_CLOSE(q.derivative(i), (x / c0).derivative(i), eps);
+    BOOST_CHECK_EQUAL(r.derivative(i), i == 0 ? T(1) : T(0));
+  }
+}
+
+// Products of series that end below their Order must agree with the convolution of their coefficients.
+BOOST_AUTO_TEST_CASE_TEMPLATE(truncated_products, T, bin_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e2 * test_constants::pct_epsilon();
+  constexpr std::size_t m = 5;
+  auto const e = make_fvar<T, m>(0);
+  for (auto na : boost::irange(m + 2)) {
+    for (auto nb : boost::irange(m + 2)) {
+      std::array<T, m + 1> a{}, b{}, ab{};
+      autodiff_fvar<T, m> fa(0), fb(0), ei(1);
+      for (auto i : boost::irange(m + 1)) {
+        a[i] = i < na ? T(i + 1) / 4 : T(0);
+        b[i] = i < nb ? T(3) / (i + 2) : T(0);
+        fa += a[i] * ei;
+        fb += b[i] * ei;
+        ei *= e;
+      }
+      for (auto i : boost::irange(m + 1))
+        for (auto j : boost::irange(m + 1 - i))
+          ab[i + j] += a[i] * b[j];
+      auto fab = fa;
+      fab *= fb;
+      for (auto k : boost::irange(m + 1)) {
+        BOOST_CHECK_CLOSE((fa * fb)[k], ab[k], eps);
+        BOOST_CHECK_CLOSE(fab[k], ab[k], eps);
+      }
+    }
+  }
+}
+
+// The sub-tensors of a nested fvar that are 0 are skipped.
+BOOST_AUTO_TEST_CASE_TEMPLATE(nested_zeros, T, bin_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  constexpr std::size_t m = 3;
+  T const x0 = 0.5;
+  T const y0 = 0.25;
+  auto const variables = make_ftuple<T, m, m>(x0, y0);
+  auto const& x = std::get<0>(variables);
+  auto const& y = std::get<1>(variables);
+  auto const z = exp(x) * sin(y);
+  auto const w = exp(x * 0 + y * 0 + y0);
+  T const sin_y[4]{sin(y0), cos(y0), -sin(y0), -cos(y0)};
+  for (auto i : boost::irange(m + 1))
+    for (auto j : boost::irange(m + 1)) {
+      BOOST_CHECK_CLOSE(z.derivative(i, j), exp(x0) * sin_y[j], eps);
+      BOOST_CHECK_EQUAL(w.derivative(i, j), i == 0 && j == 0 ? exp(y0) : T(0));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,100 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_25)
+
+// x * y, y * x, y / x, 1 / x and y / c for an independent variable x = x0 + e, a constant c and
+// y = exp(y0 + e), and exp, log and pow of x, which sum only over the terms of x that are not 0, against
+// their derivatives by the Leibniz rule, with those of y all equal to exp(y0).
+BOOST_AUTO_TEST_CASE_TEMPLATE(independent_variable, T, all_float_types) {
+  using std::exp;
+  using std::log;
+  using std::pow;
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  T const x0 = 1.5;
+  T const y0 = 0.5;
+  T const c0 = 1.25;
+  mp11::mp_for_each<mp11::mp_list_c<size_t, 2, 5, BOOST_AUTODIFF_UNROLL_THRESHOLD + 3, 24>>([&](auto order) {
+    constexpr size_t m = decltype(order)::value;
+    auto const x = make_fvar<T, m>(x0);
+    auto const y = exp(make_fvar<T, m>(y0));
+    autodiff_fvar<T, m> const c(c0);
+    auto const xy = x * y;
+    auto const yx = y * x;
+    auto y_x = y;
+    y_x *= x;
+    auto const y_over_x = y / x;
+    auto y_x_ = y;
+    y_x_ /= x;
+    auto const inv_x = 1 / x;
+    auto const yc = y / c;
+    auto const ex = exp(x);
+    auto const lx = log(x);
+    auto const px = pow(x, c0);
+    T const ey = exp(y0);
+    T power = x0;    // Derivatives of x^c0, from c0*(c0-1)*...*(c0-i+1)*x0^(c0-i).
+    T inverse = 1;   // i-th derivative of 1/x, (-1)^i*i!/x0^(i+1).
+    std::array<T, m + 1> inverses{};
+    for (auto i : boost::irange(m + 1)) {
+      inverse = i == 0 ? 1 / x0 : -inverse * i / x0;
+      inverses[i] = inverse;
+      T quotient = 0;  // i-th derivative of y/x = sum of binomial(i,j)*y^(i-j)*(1/x)^(j).
+      for (auto j : boost::irange(i + 1))
+        quotient += boost::math::binomial_coefficient<T>(static_cast<unsigned>(i), static_cast<unsigned>(j)) *
+                    ey * inverses[j];
+      BOOST_CHECK_CLOSE(xy.derivative(i), ey * (x0 + i), eps);
+      BOOST_CHECK_CLOSE(yx.derivative(i), ey * (x0 + i), eps);
+      BOOST_CHECK_CLOSE(y_x.derivative(i), ey * (x0 + i), eps);
+      BOOST_CHECK_CLOSE(y_over_x.derivative(i), quotient, eps);
+      BOOST_CHECK_CLOSE(y_x_.derivative(i), quotient, eps);
+      BOOST_CHECK_CLOSE(inv_x.derivative(i), inverse, eps);
+      BOOST_CHECK_CLOSE(yc.derivative(i), ey / c0, eps);
+      BOOST_CHECK_CLOSE(ex.derivative(i), exp(x0), eps);
+      BOOST_CHECK_CLOSE(lx.derivative(i), i == 0 ? log(x0) : inverses[i - 1], eps);
+      BOOST_CHECK_CLOSE(px.derivative(i), power * pow(x0, c0 - 1), eps);
+      power *= (c0 - i) / x0;
+    }
+  });
+}
+
+#ifndef BOOST_AUTODIFF_SKIP_ZEROS
+// Without BOOST_AUTODIFF_SKIP_ZEROS, the coefficients of (inf + e)*(3 + e), (3 + e)/(0 + e) and 1/(0 + e)
+// past the first two are NaN, from 0 times inf, as in the loops over all coefficients, whatever the Order.
+BOOST_AUTO_TEST_CASE_TEMPLATE(non_finite, T, bin_float_types) {
+  mp11::mp_for_each<mp11::mp_list_c<size_t, 5, BOOST_AUTODIFF_UNROLL_THRESHOLD + 3, 20>>([&](auto order) {
+    constexpr size_t m = decltype(order)::value;
+    T const inf = std::numeric_limits<T>::infinity();
+    auto const x = make_fvar<T, m>(0);
+    auto const y = make_fvar<T, m>(3);
+    auto const product = make_fvar<T, m>(inf) * y;
+    auto product_ = make_fvar<T, m>(inf);
+    product_ *= y;
+    auto const quotient = y / x;
+    auto quotient_ = y;
+    quotient_ /= x;
+    auto const inverse = 1 / x;
+    for (auto i : boost::irange(m + 1)) {
+      if (i < 2) {
+        BOOST_CHECK_EQUAL(product[i], inf);
+        BOOST_CHECK_EQUAL(product_[i], inf);
+        BOOST_CHECK_EQUAL(quotient[i], i ? -inf : inf);
+        BOOST_CHECK_EQUAL(quotient_[i], i ? -inf : inf);
+        BOOST_CHECK_EQUAL(inverse[i], i ? -inf : inf);
+      } else {
+        BOOST_CHECK(boost::math::isnan(product[i]));
+        BOOST_CHECK(boost::math::isnan(product_[i]));
+        BOOST_CHECK(boost::math::isnan(quotient[i]));
+        BOOST_CHECK(boost::math::isnan(quotient_[i]));
+        BOOST_CHECK(boost::math::isnan(inverse[i]));
+      }
+    }
+  });
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
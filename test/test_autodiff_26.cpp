@@ -0,0 +1,67 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_AUTODIFF_FAST_MATH
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_26)
+
+// With BOOST_AUTODIFF_FAST_MATH, the coefficients that are 0 are multiplied rather than skipped, and sqrt and
+// pow compose by Horner's method near 0. The results of finite arguments are unchanged.
+BOOST_AUTO_TEST_CASE_TEMPLATE(finite_arithmetic, T, bin_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  constexpr std::size_t m = 5;
+  T const x0 = 1.5;
+  auto x = make_fvar<T, m>(x0);
+  x *= T(2.5);
+  auto const y = sqrt(x) * T(0.5);
+  for (auto i : boost::irange(m + 1)) {
+    BOOST_CHECK_EQUAL(x.derivative(i), i == 0 ? 2.5 * x0 : i == 1 ? T(2.5) : T(0));
+    T d = T(0.5) * pow(2.5 * x0, T(0.5) - i);  // 0.5 * sqrt(x)^(i), of x with derivative 1 (not 2.5).
+    for (auto j : boost::irange(i))
+      d *= (T(0.5) - j) * T(2.5);
+    BOOST_CHECK_CLOSE(y.derivative(i), d, eps);
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(horner_near_0, T, bin_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  constexpr std::size_t m = 3;
+  T const x0 = std::numeric_limits<T>::epsilon() / 2;
+  auto const x = make_fvar<T, m>(x0);
+  auto const s = sqrt(x);
+  T d = sqrt(x0);
+  for (auto i : boost::irange(m + 1)) {
+    BOOST_CHECK_CLOSE(s.derivative(i), d, eps);
+    d *= (T(0.5) - i) / x0;
+  }
+  auto const variables = make_ftuple<T, m, m>(x0, 1.25);
+  auto const& u = std::get<0>(variables);
+  auto const& v = std::get<1>(variables);
+  auto const p = pow(u, v);
+  auto const q = exp(v * log(u));
+  for (auto i : boost::irange(m + 1))
+    for (auto j : boost::irange(m + 1))
+      BOOST_CHECK_CLOSE(p.derivative(i, j), q.derivative(i, j), eps);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(nested_functions, T, bin_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  constexpr std::size_t m = 3;
+  T const x0 = 0.5;
+  T const y0 = 0.25;
+  auto const variables = make_ftuple<T, m, m>(x0, y0);
+  auto const& x = std::get<0>(variables);
+  auto const& y = std::get<1>(variables);
+  auto const z = exp(x + y) * 2;
+  for (auto i : boost::irange(m + 1))
+    for (auto j : boost::irange(m + 1))
+      BOOST_CHECK_CLOSE(z.derivative(i, j), 2 * exp(x0 + y0), eps);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,137 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+#include <boost/math/differentiation/autodiff_split_precision.hpp>
+#include <boost/math/differentiation/autodiff_total_degree.hpp>
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_27)
+
+struct split_precision_test_function {
+  template <typename X>
+  X operator()(X const& x) const {
+    using std::atan;
+    using std::exp;
+    using std::log;
+    using std::pow;
+    using std::sin;
+    using std::sqrt;
+    return exp(x * sin(x) / (1 + x * x)) + sqrt(x) * log(x) - pow(x, 2.5) / atan(x) + 1 / x;
+  }
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(split_precision_variable, T, all_float_types) {
+  constexpr std::size_t m = 5;
+  constexpr std::size_t k = 2;
+  auto const x = make_spvar<T, float, m, k>(3);
+  BOOST_CHECK_EQUAL(x.derivative(0), 3);
+  BOOST_CHECK_EQUAL(x.derivative(1), 1);
+  BOOST_CHECK_EQUAL(x.derivative(2), 0);
+  BOOST_CHECK_THROW(x.derivative(m + 1), std::out_of_range);
+  auto const y = make_spvar<T, float, m, 1>(3);
+  BOOST_CHECK_EQUAL(y.derivative(0), 3);
+  BOOST_CHECK_EQUAL(y.derivative(1), 1);
+  // Polynomials are exact in both precisions.
+  auto const p = x * x * x - 2 * x + 7;
+  BOOST_CHECK_EQUAL(p.derivative(0), 3 * 3 * 3 - 2 * 3 + 7);
+  BOOST_CHECK_EQUAL(p.derivative(1), 3 * 3 * 3 - 2);
+  BOOST_CHECK_EQUAL(p.derivative(2), 6 * 3);
+  BOOST_CHECK_EQUAL(p.derivative(3), 6);
+  BOOST_CHECK_EQUAL(p.derivative(4), 0);
+  // Division inverts multiplication.
+  auto q = p;
+  q *= x + 1;
+  q /= x + 1;
+  for (auto i : boost::irange(m + 1))
+    BOOST_CHECK_CLOSE(q.derivative(i), p.derivative(i), 1e2 * test_constants_t<float>::pct_epsilon());
+}
+
+// The derivatives of order < K agree with fvar<T,Order> to the precision of T, and the rest to that of float.
+BOOST_AUTO_TEST_CASE_TEMPLATE(split_precision_matches_fvar, T, all_float_types) {
+  constexpr std::size_t m = 6;
+  constexpr std::size_t k = 3;
+  T const eps = 1e3 * test_constants_t<T>::pct_epsilon();
+  T const low_eps = 1e4 * test_constants_t<float>::pct_epsilon();
+  T const x0 = 1.5;
+  auto const u = split_precision_test_function{}(make_spvar<T, float, m, k>(x0));
+  auto const v = split_precision_test_function{}(make_fvar<T, m>(x0));
+  for (auto i : boost::irange(m + 1))
+    BOOST_CHECK_CLOSE(u.derivative(i), v.derivative(i), i < k ? eps : low_eps);
+  auto const w = atan2(make_spvar<T, float, m, k>(x0), T(2)) * fabs(1 - make_spvar<T, float, m, k>(x0));
+  auto const z = atan2(make_fvar<T, m>(x0), T(2)) * fabs(1 - make_fvar<T, m>(x0));
+  for (auto i : boost::irange(m + 1))
+    BOOST_CHECK_CLOSE(w.derivative(i), z.derivative(i), i < k ? eps : low_eps);
+}
+
+struct split_precision_multivariate_function {
+  template <typename X>
+  X operator()(X const& x, X const& y, X const& z) const {
+    using std::exp;
+    using std::sin;
+    using std::sqrt;
+    return exp(x * sin(y) / z) + sqrt(x * z) / y - atan2(x, z) * y * y + 3 / (x + y);
+  }
+};
+
+// The mixed partial derivatives of total order < K agree with tdvar<T,3,Order> to the precision of T, and the
+// rest to that of float.
+BOOST_AUTO_TEST_CASE_TEMPLATE(split_precision_multivariate, T, all_float_types) {
+  constexpr std::size_t m = 4;
+  constexpr std::size_t k = 2;
+  T const eps = 1e3 * test_constants_t<T>::pct_epsilon();
+  T const low_eps = 1e4 * test_constants_t<float>::pct_epsilon();
+  auto const x = make_sptuple<T, float, m, k>(1.5, 2, 2.5);
+  BOOST_CHECK_EQUAL(x[0].size, 35u);
+  BOOST_CHECK_EQUAL(x[1].derivative(0, 0, 0), 2);
+  BOOST_CHECK_EQUAL(x[1].derivative(0, 1, 0), 1);
+  BOOST_CHECK_EQUAL(x[1].derivative(1, 0, 0), 0);
+  BOOST_CHECK_THROW(x[0].derivative(2, 2, 1), std::out_of_range);
+  BOOST_CHECK_THROW((autodiff_spvar<T, float, m, k, 3>(1, 3)), std::out_of_range);
+  BOOST_CHECK_THROW((autodiff_spvar<T, float, m, 1, 2>(1, 2)), std::out_of_range);
+  auto const y = make_sptuple<T, float, m, 1>(1.5, 2);
+  BOOST_CHECK_EQUAL(y[1].derivative(0, 1), 1);
+  BOOST_CHECK_EQUAL(y[1].derivative(1, 0), 0);
+  auto const t = make_tdtuple<T, m>(1.5, 2, 2.5);
+  auto const u = split_precision_multivariate_function{}(x[0], x[1], x[2]);
+  auto const v = split_precision_multivariate_function{}(t[0], t[1], t[2]);
+  for (auto i : boost::irange(m + 1))
+    for (auto j : boost::irange(m + 1 - i))
+      for (auto l : boost::irange(m + 1 - i - j))
+        BOOST_CHECK_CLOSE(u.derivative(i, j, l), v.derivative(i, j, l), i + j + l < k ? eps : low_eps);
+  // Division inverts multiplication.
+  auto q = u;
+  q *= x[0] * x[2] + 1;
+  q /= x[0] * x[2] + 1;
+  for (auto i : boost::irange(m + 1))
+    for (auto j : boost::irange(m + 1 - i))
+      BOOST_CHECK_CLOSE(q.derivative(i, j, 0), u.derivative(i, j, 0), i + j < k ? eps : low_eps);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(split_precision_comparisons_and_rounding, T, all_float_types) {
+  constexpr std::size_t m = 4;
+  constexpr std::size_t k = 2;
+  T const eps = 1e3 * test_constants_t<T>::pct_epsilon();
+  T const low_eps = 1e4 * test_constants_t<float>::pct_epsilon();
+  T const x0 = 2.5;
+  auto const x = make_spvar<T, float, m, k>(x0);
+  BOOST_CHECK(x == x0 && x0 == x && x != x + 1 && x < 3 && 2 < x && x <= x0 && x0 >= x && x > 2);
+  BOOST_CHECK(!(x < x0) && !(x > x + 1));
+  for (auto const& r : {ceil(x), floor(x), round(x), trunc(x)}) {
+    BOOST_CHECK_EQUAL(r.derivative(0), static_cast<T>(static_cast<int>(r.derivative(0))));
+    for (auto i : boost::irange(std::size_t(1), m + 1))
+      BOOST_CHECK_EQUAL(r.derivative(i), 0);
+  }
+  BOOST_CHECK_EQUAL(ceil(x).derivative(0), 3);
+  BOOST_CHECK_EQUAL(floor(x).derivative(0), 2);
+  BOOST_CHECK_EQUAL(trunc(-x).derivative(0), -2);
+  BOOST_CHECK_EQUAL(fabs(x - x0).derivative(1), 0);
+  auto const u = pow(T(2), x) * pow(x, T(1.5)) / pow(x, x);
+  auto const v = pow(T(2), make_fvar<T, m>(x0)) * pow(make_fvar<T, m>(x0), T(1.5)) /
+                 pow(make_fvar<T, m>(x0), make_fvar<T, m>(x0));
+  for (auto i : boost::irange(m + 1))
+    BOOST_CHECK_CLOSE(u.derivative(i), v.derivative(i), i < k ? eps : low_eps);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,77 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_28)
+
+// At Order 30 the Taylor coefficients of 1/x and log(x) at a small x0, and of exp(x/r) at a large r, leave
+// the range of T, while those scaled by the radius x0 or r stay of order 1.
+BOOST_AUTO_TEST_CASE_TEMPLATE(scaled_coefficients, T, bin_float_types) {
+  using std::exp;
+  using std::ldexp;
+  using std::log;
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  constexpr std::size_t m = 30;
+  int const e = std::numeric_limits<T>::max_exponent / 16;
+  T const s = ldexp(T(1), -e);
+  T const r = ldexp(T(1), e);
+  auto const x = make_fvar<T, m>(s, s);
+  auto const y = make_fvar<T, m>(r, r);
+  auto const inv_x = 1 / x;
+  auto const log_x = log(x);
+  auto const exp_y = exp(y / r);
+  auto const unscaled_inv_x = 1 / make_fvar<T, m>(s);
+  BOOST_CHECK(!isfinite(unscaled_inv_x[m]));
+  T inverse_factorial = 1;
+  for (auto i : boost::irange(m + 1)) {
+    BOOST_CHECK_EQUAL(inv_x[i], (i % 2 ? -1 : 1) / s);
+    if (i == 0)
+      BOOST_CHECK_CLOSE(log_x[i], log(s), eps);
+    else
+      BOOST_CHECK_CLOSE(log_x[i], T(i % 2 ? 1 : -1) / i, eps);
+    BOOST_CHECK_CLOSE(exp_y[i], exp(T(1)) * inverse_factorial, eps);
+    inverse_factorial /= i + 1;
+  }
+  // The derivatives are recovered where they are within range.
+  for (auto i : boost::irange(std::size_t(8))) {
+    BOOST_CHECK_CLOSE(inv_x.unscaled_derivative(s, i), unscaled_inv_x.derivative(i), eps);
+    BOOST_CHECK_CLOSE(
+        exp_y.unscaled_derivative(r, i), exp(T(1)) * ldexp(T(1), -e * static_cast<int>(i)), eps);
+  }
+}
+
+// Where the coefficients are within range either way, the scaled and unscaled variables agree.
+BOOST_AUTO_TEST_CASE_TEMPLATE(scaled_functions, T, all_float_types) {
+  using std::exp;
+  using std::log;
+  using std::pow;
+  using std::sin;
+  using std::sqrt;
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e3 * test_constants::pct_epsilon();
+  constexpr std::size_t m = 10;
+  T const x0 = 1.5;
+  T const radius = 0.75;
+  auto const f = [](autodiff_fvar<T, m> const& x) {
+    return exp(x * sin(x) / (1 + x * x)) + sqrt(x) * log(x) - pow(x, 2.5) / atan(x) + erf(x) * tan(x);
+  };
+  auto const u = f(make_fvar<T, m>(x0, radius));
+  auto const v = f(make_fvar<T, m>(x0));
+  for (auto i : boost::irange(m + 1))
+    BOOST_CHECK_CLOSE(u.unscaled_derivative(radius, i), v.derivative(i), eps);
+  // Of a nested fvar, in x only.
+  constexpr std::size_t n = 3;
+  T const y0 = 0.5;
+  auto const y = make_fvar<T, 0, n>(y0);
+  auto const g = make_fvar<T, n>(x0, radius) * exp(make_fvar<T, n>(x0, radius) - y) / y;
+  auto const h = make_fvar<T, n>(x0) * exp(make_fvar<T, n>(x0) - y) / y;
+  for (auto i : boost::irange(n + 1))
+    for (auto j : boost::irange(n + 1))
+      BOOST_CHECK_CLOSE(g.unscaled_derivative(radius, i).derivative(j), h.derivative(i, j), eps);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
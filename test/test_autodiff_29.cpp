@@ -0,0 +1,204 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+
+#include <memory>
+#include <utility>
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_29)
+
+namespace {
+
+template <typename T>
+void check_close(T const& actual, T const& expected, T const eps) {
+  BOOST_CHECK_CLOSE(actual, expected, eps);
+}
+
+// Compares every derivative, of each variable of a nested fvar.
+template <typename RealType, std::size_t Order, typename T>
+void check_close(detail::fvar<RealType, Order> const& actual,
+                 detail::fvar<RealType, Order> const& expected,
+                 T const eps) {
+  for (auto i : boost::irange(Order + 1))
+    check_close(actual.derivative(i), expected.derivative(i), eps);
+}
+
+std::size_t allocations = 0;
+
+// std::allocator that counts its calls to allocate().
+template <typename T>
+struct counting_allocator {
+  using value_type = T;
+  counting_allocator() = default;
+  template <typename U>
+  counting_allocator(counting_allocator<U> const&) {}
+  T* allocate(std::size_t n) {
+    ++allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+};
+
+template <typename T, typename U>
+bool operator==(counting_allocator<T> const&, counting_allocator<U> const&) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(counting_allocator<T> const&, counting_allocator<U> const&) {
+  return false;
+}
+
+// The number of allocations made by func().
+template <typename Func>
+std::size_t count_allocations(Func const& func) {
+  allocations = 0;
+  func();
+  return allocations;
+}
+
+// The allocations of rvalue(std::move(a)) and of lvalue(a), where a is a copy of x made beforehand. The
+// lvalue is counted first, so that the constants a function computes on its first call are not counted
+// against the rvalue.
+template <typename Fvar, typename Rvalue, typename Lvalue>
+std::pair<std::size_t, std::size_t> count_allocations(Fvar const& x,
+                                                      Rvalue const& rvalue,
+                                                      Lvalue const& lvalue) {
+  Fvar a(x);
+  std::size_t const lvalue_allocations = count_allocations([&] { Fvar const r = lvalue(x); });
+  std::size_t const rvalue_allocations = count_allocations([&] { Fvar const r = rvalue(std::move(a)); });
+  return {rvalue_allocations, lvalue_allocations};
+}
+
+}  // namespace
+
+// Each overload with an fvar&& operand gives the result of the corresponding overload with const& operands.
+BOOST_AUTO_TEST_CASE_TEMPLATE(rvalue_operators, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = test_constants::pct_epsilon();
+  constexpr std::size_t m = 5;
+  T const cx = 1.5;
+  T const cy = 2.25;
+  T const ca = 0.75;
+  auto const x = make_fvar<T, m>(cx);
+  auto const y = exp(x) / (x + 1);
+  using fvar_t = autodiff_fvar<T, m>;
+  auto copy = [](fvar_t const& cr) { return fvar_t(cr); };
+
+  check_close(copy(x) + y, x + y, eps);
+  check_close(x + copy(y), x + y, eps);
+  check_close(copy(x) + copy(y), x + y, eps);
+  check_close(copy(x) + ca, x + ca, eps);
+  check_close(ca + copy(x), ca + x, eps);
+
+  check_close(copy(x) - y, x - y, eps);
+  check_close(x - copy(y), x - y, eps);
+  check_close(copy(x) - copy(y), x - y, eps);
+  check_close(copy(x) - ca, x - ca, eps);
+  check_close(ca - copy(x), ca - x, eps);
+  check_close(-copy(y), -y, eps);
+
+  check_close(copy(x) * y, x * y, eps);
+  check_close(x * copy(y), x * y, eps);
+  check_close(copy(x) * copy(y), x * y, eps);
+  check_close(copy(x) * ca, x * ca, eps);
+  check_close(ca * copy(x), ca * x, eps);
+
+  check_close(copy(x) / y, x / y, eps);
+  check_close(copy(x) / ca, x / ca, eps);
+
+  // An fvar&& operand of the promoted type, with a const& operand of lower depth.
+  auto const z = make_fvar<T, 0, m>(cy);
+  auto const xz = x * z;
+  using fvar2_t = autodiff_fvar<T, m, m>;
+  auto copy2 = [](fvar2_t const& cr) { return fvar2_t(cr); };
+  check_close(copy2(xz) + x, xz + x, eps);
+  check_close(x + copy2(xz), x + xz, eps);
+  check_close(copy2(xz) - x, xz - x, eps);
+  check_close(x - copy2(xz), x - xz, eps);
+  check_close(copy2(xz) * x, xz * x, eps);
+  check_close(x * copy2(xz), x * xz, eps);
+  check_close(copy2(xz) / x, xz / x, eps);
+}
+
+// apply_coefficients() and apply_derivatives() of an rvalue, which reuse its storage, give the same results
+// as of an lvalue.
+BOOST_AUTO_TEST_CASE_TEMPLATE(rvalue_apply, T, all_float_types) {
+  using test_constants = test_constants_t<T>;
+  T const eps = 1e2 * test_constants::pct_epsilon();
+  constexpr std::size_t m = 5;
+  auto const x = make_fvar<T, m>(0.5);
+  using fvar_t = autodiff_fvar<T, m>;
+  auto copy = [](fvar_t const& cr) { return fvar_t(cr); };
+  auto const f = [](std::size_t i) { return T(1) / (i + 1); };
+
+  check_close(copy(x).apply_coefficients(m, f), x.apply_coefficients(m, f), eps);
+  check_close(copy(x).apply_coefficients_nonhorner(m, f), x.apply_coefficients_nonhorner(m, f), eps);
+  check_close(copy(x).apply_derivatives(m, f), x.apply_derivatives(m, f), eps);
+  check_close(copy(x).apply_derivatives_nonhorner(m, f), x.apply_derivatives_nonhorner(m, f), eps);
+}
+
+// With a root_type that allocates its limbs, an fvar&& operand never allocates more than a const& operand.
+// The move constructor of cpp_bin_float may copy the limbs, as many allocations as the copy that an fvar&&
+// operand saves, so only the sums, differences and quotients of two fvar are sure to allocate less.
+BOOST_AUTO_TEST_CASE(rvalue_allocations) {
+  using float50a = bmp::number<bmp::cpp_bin_float<50, bmp::digit_base_10, counting_allocator<bmp::limb_type>>,
+                               bmp::et_off>;
+  constexpr std::size_t m = 5;
+  using fvar_t = autodiff_fvar<float50a, m>;
+  auto const x = exp(make_fvar<float50a, m>(1.5));
+  auto const y = sin(make_fvar<float50a, m>(2.5));
+  auto const z = make_fvar<float50a, m>(0.5);
+  float50a const ca = 0.75;
+  std::pair<std::size_t, std::size_t> allocations;
+
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return std::move(a) + y; }, [&](fvar_t const& a) { return a + y; });
+  BOOST_CHECK_LT(allocations.first, allocations.second);
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return y + std::move(a); }, [&](fvar_t const& a) { return y + a; });
+  BOOST_CHECK_LT(allocations.first, allocations.second);
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return std::move(a) - y; }, [&](fvar_t const& a) { return a - y; });
+  BOOST_CHECK_LT(allocations.first, allocations.second);
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return std::move(a) / y; }, [&](fvar_t const& a) { return a / y; });
+  BOOST_CHECK_LT(allocations.first, allocations.second);
+
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return y - std::move(a); }, [&](fvar_t const& a) { return y - a; });
+  BOOST_CHECK_LE(allocations.first, allocations.second);
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return std::move(a) * y; }, [&](fvar_t const& a) { return a * y; });
+  BOOST_CHECK_LE(allocations.first, allocations.second);
+  // A truncated product and quotient, by an independent variable.
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return std::move(a) * z; }, [&](fvar_t const& a) { return a * z; });
+  BOOST_CHECK_LE(allocations.first, allocations.second);
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return z * std::move(a); }, [&](fvar_t const& a) { return z * a; });
+  BOOST_CHECK_LE(allocations.first, allocations.second);
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return std::move(a) / z; }, [&](fvar_t const& a) { return a / z; });
+  BOOST_CHECK_LE(allocations.first, allocations.second);
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return std::move(a) + ca; }, [&](fvar_t const& a) { return a + ca; });
+  BOOST_CHECK_LE(allocations.first, allocations.second);
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return ca - std::move(a); }, [&](fvar_t const& a) { return ca - a; });
+  BOOST_CHECK_LE(allocations.first, allocations.second);
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return ca * std::move(a); }, [&](fvar_t const& a) { return ca * a; });
+  BOOST_CHECK_LE(allocations.first, allocations.second);
+  allocations = count_allocations(
+      x, [&](fvar_t&& a) { return std::move(a) / ca; }, [&](fvar_t const& a) { return a / ca; });
+  BOOST_CHECK_LE(allocations.first, allocations.second);
+  allocations = count_allocations(
+      x, [](fvar_t&& a) { return -std::move(a); }, [](fvar_t const& a) { return -a; });
+  BOOST_CHECK_LE(allocations.first, allocations.second);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,314 @@
+//           Copyright Matthew Pulver 2018 - 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+#include <boost/math/differentiation/autodiff_batch.hpp>
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_9)
+
+constexpr std::size_t lanes = 4;
+
+template <typename X, typename Y>
+promote<X, Y> batch_test_function(X const& x, Y const& y) {
+  using std::exp;
+  using std::log;
+  using std::sqrt;
+  using std::atan2;
+  using boost::math::erfc;
+  return exp(-x * y) * sqrt(x) + log(y) / (1 + x * x) - atan2(x, y) * erfc(y / x) + pow(x, 3) / y;
+}
+
+// Functions that branch on the value of their argument.
+struct branching_function {
+  int n;
+
+  template <typename X>
+  X operator()(X const& x) const {
+    switch (n) {
+      case 0:
+        return fabs(x);
+      case 1:
+        return sqrt(x);
+      case 2:
+        return log(x);
+      case 3:
+        return pow(x, 2.5);
+      case 4:
+        return pow(x, x);
+      case 5:
+        return atan2(x, 0.5);
+      case 6:
+        return asin(x);
+      case 7:
+        return acosh(x * x + 1);
+      default:
+        return sinc(x);
+    }
+  }
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_operations, T, bin_float_types) {
+  using batch_t = batch<T, lanes>;
+  batch_t const a(std::array<T, lanes>{{1, 2, 3, 4}});
+  batch_t const b = a * 2 + 1;
+  for (std::size_t i = 0; i < lanes; ++i) {
+    BOOST_CHECK_EQUAL(a[i], static_cast<T>(i + 1));
+    BOOST_CHECK_EQUAL(b[i], static_cast<T>(2 * i + 3));
+    BOOST_CHECK_EQUAL((b - a)[i], static_cast<T>(i + 2));
+    BOOST_CHECK_EQUAL((b / a * a)[i], b[i]);
+    BOOST_CHECK_EQUAL((-a)[i], -a[i]);
+  }
+  BOOST_CHECK(a < b);
+  BOOST_CHECK(a <= b);
+  BOOST_CHECK(b > a);
+  BOOST_CHECK(0 < a);
+  BOOST_CHECK(a == a);
+  BOOST_CHECK(!(a == 1));
+  BOOST_CHECK(a != 1);
+  BOOST_CHECK(!(a < 2));
+  BOOST_CHECK(!(a >= 2));
+  BOOST_CHECK(batch_t(3) == 3);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_matches_scalar, T, bin_float_types) {
+  using test_constants = test_constants_t<T, 4>;
+  static constexpr auto m = test_constants::order;
+  using batch_t = batch<T, lanes>;
+  test_detail::RandomSample<T> x_sampler{1, 10};
+  test_detail::RandomSample<T> y_sampler{1, 10};
+  for (auto i : boost::irange(test_constants::n_samples)) {
+    std::ignore = i;
+    batch_t bx, by;
+    for (std::size_t lane = 0; lane < lanes; ++lane) {
+      bx[lane] = x_sampler.next();
+      by[lane] = y_sampler.next();
+    }
+    auto const variables = make_ftuple<batch_t, m, m>(bx, by);
+    auto const f = batch_test_function(std::get<0>(variables), std::get<1>(variables));
+    for (std::size_t lane = 0; lane < lanes; ++lane) {
+      auto const scalar_variables = make_ftuple<T, m, m>(bx[lane], by[lane]);
+      auto const g = batch_test_function(std::get<0>(scalar_variables), std::get<1>(scalar_variables));
+      for (auto j : boost::irange(m + 1)) {
+        for (auto k : boost::irange(m + 1 - j)) {
+          BOOST_CHECK_CLOSE(f.derivative(j, k)[lane], g.derivative(j, k), test_constants::pct_epsilon());
+        }
+      }
+    }
+  }
+}
+
+// A lane count that is not a power of 2 is aligned to the next power of 2.
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_three_lanes, T, bin_float_types) {
+  using test_constants = test_constants_t<T, 3>;
+  static constexpr auto m = test_constants::order;
+  using batch_t = batch<T, 3>;
+  static_assert(alignof(batch_t) % alignof(T) == 0, "batch<T,3> must be aligned for its lane type.");
+  batch_t const x0(std::array<T, 3>{{1.5, 2, 4}});
+  batch_t const y0(std::array<T, 3>{{3, 0.5, 1.25}});
+  auto const variables = make_ftuple<batch_t, m, m>(x0, y0);
+  auto const f = batch_test_function(std::get<0>(variables), std::get<1>(variables));
+  for (std::size_t lane = 0; lane < 3; ++lane) {
+    auto const scalar_variables = make_ftuple<T, m, m>(x0[lane], y0[lane]);
+    auto const g = batch_test_function(std::get<0>(scalar_variables), std::get<1>(scalar_variables));
+    for (auto j : boost::irange(m + 1))
+      for (auto k : boost::irange(m + 1 - j))
+        BOOST_CHECK_CLOSE(f.derivative(j, k)[lane], g.derivative(j, k), test_constants::pct_epsilon());
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_mixed_sign_lanes, T, bin_float_types) {
+  using test_constants = test_constants_t<T, 4>;
+  static constexpr auto m = test_constants::order;
+  using batch_t = batch<T, lanes>;
+  batch_t const x0(std::array<T, lanes>{{-1.5, 2, 0, 0.5}});
+  auto const x = make_fvar<batch_t, m>(x0);
+  auto const y = fabs(x);
+  auto const variables = make_ftuple<batch_t, m, m>(x0, batch_t(2));
+  auto const z = fabs(std::get<0>(variables) * std::get<1>(variables));
+  for (std::size_t lane = 0; lane < lanes; ++lane) {
+    T const sign = x0[lane] < 0 ? -1 : 0 < x0[lane] ? 1 : 0;
+    BOOST_CHECK_EQUAL(y.derivative(0)[lane], sign * x0[lane]);
+    BOOST_CHECK_EQUAL(y.derivative(1)[lane], sign);
+    BOOST_CHECK_EQUAL(z.derivative(1, 1)[lane], sign);
+    for (auto j : boost::irange(std::size_t(2), m + 1))
+      BOOST_CHECK_EQUAL(y.derivative(j)[lane], 0);
+  }
+  for (int n = 0; n < 9; ++n) {
+    branching_function const func{n};
+    auto const f = func(x);
+    for (std::size_t lane = 0; lane < lanes; ++lane) {
+      auto const g = func(make_fvar<T, m>(x0[lane]));
+      for (auto j : boost::irange(m + 1)) {
+        if (boost::math::isnan(g.derivative(j)))
+          BOOST_CHECK(boost::math::isnan(f.derivative(j)[lane]));
+        else if (boost::math::isinf(g.derivative(j)))
+          BOOST_CHECK_EQUAL(f.derivative(j)[lane], g.derivative(j));
+        else
+          BOOST_CHECK_CLOSE(f.derivative(j)[lane], g.derivative(j), test_constants::pct_epsilon());
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_tiny_lanes, T, bin_float_types) {
+  using test_constants = test_constants_t<T, 4>;
+  static constexpr auto m = test_constants::order;
+  using batch_t = batch<T, lanes>;
+  // pow(x, y) of two fvar is evaluated without Horner's method for |x0| < epsilon, so a lane below it must
+  // not be evaluated with the others.
+  T const tiny = (std::max)(static_cast<T>(1e-300), (std::numeric_limits<T>::min)());
+  batch_t const x0(std::array<T, lanes>{{tiny, 1, 2, 3}});
+  auto const variables = make_ftuple<batch_t, m, m>(x0, batch_t(2));
+  auto const& x = std::get<0>(variables);
+  auto const& y = std::get<1>(variables);
+  auto const f = pow(x, y / 4);
+  for (std::size_t lane = 0; lane < lanes; ++lane) {
+    auto const scalar_variables = make_ftuple<T, m, m>(x0[lane], T(2));
+    auto const g = pow(std::get<0>(scalar_variables), std::get<1>(scalar_variables) / 4);
+    for (auto j : boost::irange(m + 1)) {
+      for (auto k : boost::irange(m + 1 - j)) {
+        if (boost::math::isnan(g.derivative(j, k)))
+          BOOST_CHECK(boost::math::isnan(f.derivative(j, k)[lane]));
+        else if (boost::math::isinf(g.derivative(j, k)))
+          BOOST_CHECK_EQUAL(f.derivative(j, k)[lane], g.derivative(j, k));
+        else
+          BOOST_CHECK_CLOSE(f.derivative(j, k)[lane], g.derivative(j, k), test_constants::pct_epsilon());
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_zero_times_inf_lanes, T, bin_float_types) {
+  using test_constants = test_constants_t<T, 4>;
+  static constexpr auto m = test_constants::order;
+  using batch_t = batch<T, lanes>;
+  // The coefficients of x * x that are 0 in some lanes only stay 0 where they are multiplied by inf, as for a
+  // scalar, instead of becoming NaN.
+  batch_t const x0(std::array<T, lanes>{{0, 1, 0, 2}});
+  T const inf = std::numeric_limits<T>::infinity();
+  batch_t const c(std::array<T, lanes>{{inf, 2, 3, inf}});
+  auto const x = make_fvar<batch_t, m>(x0);
+  auto f = x * x;
+  f *= c;
+  auto const g = x * x * c;
+  for (std::size_t lane = 0; lane < lanes; ++lane) {
+    auto const y = make_fvar<T, m>(x0[lane]);
+    auto h = y * y;
+    h *= c[lane];
+    for (auto j : boost::irange(m + 1)) {
+      if (boost::math::isnan(h.derivative(j))) {
+        BOOST_CHECK(boost::math::isnan(f.derivative(j)[lane]));
+        BOOST_CHECK(boost::math::isnan(g.derivative(j)[lane]));
+      } else {
+        BOOST_CHECK_EQUAL(f.derivative(j)[lane], h.derivative(j));
+        BOOST_CHECK_EQUAL(g.derivative(j)[lane], h.derivative(j));
+      }
+    }
+  }
+}
+
+// inverse() takes a different branch where the root is 0, so lanes 0 and 2 get the infinite derivatives of a
+// scalar 1/0 instead of NaN.
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_inverse_zero_lanes, T, bin_float_types) {
+  using test_constants = test_constants_t<T, 3>;
+  static constexpr auto m = test_constants::order;
+  using batch_t = batch<T, lanes>;
+  batch_t const x0(std::array<T, lanes>{{0, 1, 0, 0.25}});
+  auto const f = make_fvar<batch_t, m>(x0).inverse();
+  for (std::size_t lane = 0; lane < lanes; ++lane) {
+    auto const g = make_fvar<T, m>(x0[lane]).inverse();
+    for (auto j : boost::irange(m + 1))
+      BOOST_CHECK_EQUAL(f.derivative(j)[lane], g.derivative(j));
+  }
+}
+
+// Infinite derivatives applied to x*y of a nested fvar skip its terms that are 0 in each lane separately, as
+// for a scalar, so lanes 0 and 2 are 0 or inf where x is 0.
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_nested_inf_lanes, T, bin_float_types) {
+  using test_constants = test_constants_t<T, 2>;
+  static constexpr auto m = test_constants::order;
+  using batch_t = batch<T, lanes>;
+  batch_t const x0(std::array<T, lanes>{{0, 0.25, 0, 2}});
+  T const inf = std::numeric_limits<T>::infinity();
+  auto const variables = make_ftuple<batch_t, m, m>(x0, batch_t(0.5));
+  auto const f = (std::get<0>(variables) * std::get<1>(variables))
+                     .apply_derivatives(2 * m, [inf](std::size_t) { return batch_t(inf); });
+  for (std::size_t lane = 0; lane < lanes; ++lane) {
+    auto const scalars = make_ftuple<T, m, m>(x0[lane], 0.5);
+    auto const g = (std::get<0>(scalars) * std::get<1>(scalars))
+                       .apply_derivatives(2 * m, [inf](std::size_t) { return inf; });
+    for (auto i : boost::irange(m + 1))
+      for (auto j : boost::irange(m + 1))
+        BOOST_CHECK_EQUAL(f.derivative(i, j)[lane], g.derivative(i, j));
+  }
+}
+
+// tgamma, lgamma and digamma take the derivatives of a batch from polygamma() for each lane, and tgamma is
+// evaluated lane by lane when the lanes differ in sign.
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_gamma_functions, T, bin_float_types) {
+  using test_constants = test_constants_t<T, 3>;
+  static constexpr auto m = test_constants::order;
+  using batch_t = batch<T, lanes>;
+  for (batch_t const& x0 : {batch_t(std::array<T, lanes>{{0.75, 1.5, 2.25, 6}}),
+                            batch_t(std::array<T, lanes>{{-0.5, 1.5, -2.25, 6}})}) {
+    auto const x = make_fvar<batch_t, m>(x0);
+    auto const f = tgamma(x);
+    auto const g = lgamma(fabs(x));
+    auto const h = digamma(fabs(x));
+    auto const l = ldexp(x, 3);
+    for (std::size_t lane = 0; lane < lanes; ++lane) {
+      auto const y = make_fvar<T, m>(x0[lane]);
+      auto const scalar_f = tgamma(y);
+      auto const scalar_g = lgamma(fabs(y));
+      auto const scalar_h = digamma(fabs(y));
+      for (auto j : boost::irange(m + 1)) {
+        BOOST_CHECK_CLOSE(f.derivative(j)[lane], scalar_f.derivative(j), test_constants::pct_epsilon());
+        BOOST_CHECK_CLOSE(g.derivative(j)[lane], scalar_g.derivative(j), test_constants::pct_epsilon());
+        BOOST_CHECK_CLOSE(h.derivative(j)[lane], scalar_h.derivative(j), test_constants::pct_epsilon());
+        BOOST_CHECK_EQUAL(l.derivative(j)[lane], 8 * y.derivative(j));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_black_scholes, T, bin_float_types) {
+  using test_constants = test_constants_t<T, 3>;
+  static constexpr auto m = test_constants::order;
+  using batch_t = batch<T, lanes>;
+  batch_t const K = 100;
+  batch_t const S0(std::array<T, lanes>{{90, 100, 105, 110}});
+  auto const variables = make_ftuple<batch_t, m, m, m, m>(S0, batch_t(5) / 12, batch_t(0.2), batch_t(0.03));
+  auto const& S = std::get<0>(variables);
+  auto const& tau = std::get<1>(variables);
+  auto const& sigma = std::get<2>(variables);
+  auto const& r = std::get<3>(variables);
+  auto const d1 = (log(S / K) + (r + sigma * sigma / 2) * tau) / (sigma * sqrt(tau));
+  auto const d2 = d1 - sigma * sqrt(tau);
+  auto const call = S * erfc(-d1 / boost::math::constants::root_two<T>()) / 2 -
+                    exp(-r * tau) * K * erfc(-d2 / boost::math::constants::root_two<T>()) / 2;
+  for (std::size_t lane = 0; lane < lanes; ++lane) {
+    auto const scalar_variables = make_ftuple<T, m, m, m, m>(S0[lane], T(5) / 12, T(0.2), T(0.03));
+    auto const& s = std::get<0>(scalar_variables);
+    auto const& t = std::get<1>(scalar_variables);
+    auto const& v = std::get<2>(scalar_variables);
+    auto const& q = std::get<3>(scalar_variables);
+    auto const e1 = (log(s / 100) + (q + v * v / 2) * t) / (v * sqrt(t));
+    auto const e2 = e1 - v * sqrt(t);
+    auto const scalar_call = s * erfc(-e1 / boost::math::constants::root_two<T>()) / 2 -
+                             exp(-q * t) * 100 * erfc(-e2 / boost::math::constants::root_two<T>()) / 2;
+    BOOST_CHECK_CLOSE(call.derivative(0, 0, 0, 0)[lane], scalar_call.derivative(0, 0, 0, 0),
+                      test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(call.derivative(1, 0, 0, 0)[lane], scalar_call.derivative(1, 0, 0, 0),
+                      test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(call.derivative(2, 0, 0, 0)[lane], scalar_call.derivative(2, 0, 0, 0),
+                      test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(call.derivative(0, 0, 1, 0)[lane], scalar_call.derivative(0, 0, 1, 0),
+                      test_constants::pct_epsilon());
+    BOOST_CHECK_CLOSE(call.derivative(1, 1, 1, 0)[lane], scalar_call.derivative(1, 1, 1, 0),
+                      test_constants::pct_epsilon());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()